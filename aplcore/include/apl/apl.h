@@ -46,6 +46,7 @@
 #include "apl/focus/focusdirection.h"
 #include "apl/graphic/graphic.h"
 #include "apl/graphic/graphicfilter.h"
+#include "apl/graphic/graphicpathgeometry.h"
 #include "apl/graphic/graphicpattern.h"
 #include "apl/livedata/livearray.h"
 #include "apl/livedata/livemap.h"
@@ -20,14 +20,13 @@
 
 #include "apl/action/action.h"
 #include "apl/command/command.h"
+#include "apl/command/commandtemplate.h"
 #include "apl/engine/context.h"
 #include "apl/component/corecomponent.h"
 #include "apl/primitives/object.h"
 
 namespace apl {
 
-using CommandFunc = std::function<CommandPtr(const ContextPtr&, Properties&&, const CoreComponentPtr&, const std::string&)>;
-
 class CoreCommand;
 
 /**
@@ -70,11 +69,22 @@ private:
                           const CoreComponentPtr& base,
                           const std::string& parentSequencer);
 
+    CommandPtr inflateTemplate(const ContextPtr& context,
+                               const rapidjson::Value& command,
+                               const Properties& properties,
+                               const CoreComponentPtr& base,
+                               const std::string& parentSequencer);
 
+    CommandPtr create(const ContextPtr& context,
+                      const std::string& type,
+                      Properties&& properties,
+                      const CoreComponentPtr& base,
+                      const std::string& parentSequencer);
 
     static CommandFactory *sInstance;
 
     std::map<std::string, CommandFunc> mCommandMap;
+    unsigned mGeneration = 0;  // Incremented each time the command map changes
 
 };
 
@@ -0,0 +1,176 @@
+/**
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#ifndef _APL_COMMAND_TEMPLATE_H
+#define _APL_COMMAND_TEMPLATE_H
+
+#include <functional>
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "rapidjson/document.h"
+
+#include "apl/common.h"
+#include "apl/engine/properties.h"
+#include "apl/utils/counter.h"
+#include "apl/utils/lrucache.h"
+
+namespace apl {
+
+using CommandFunc = std::function<CommandPtr(const ContextPtr&, Properties&&, const CoreComponentPtr&, const std::string&)>;
+
+/**
+ * A command definition that has been pre-processed for repeated inflation.  The "type" and "when"
+ * values and all other scalar properties are read out of the JSON once.  Scalar values without
+ * data-binding or resource references are stored in their final form; everything else is read
+ * from the JSON and evaluated on each inflation.
+ *
+ * Templates are keyed by the address of the JSON definition.  Because JSON passed in by the
+ * runtime may be released and the address reused, a template must be checked with matches()
+ * before use.  Only the scalar values are compared; arrays and maps are never held by the template.
+ *
+ * A template with a static type also remembers how its static properties were converted by the
+ * property definitions of the command, so commands built from it skip enumeration lookups and
+ * other context-free conversions.
+ */
+class CommandTemplate : public Counter<CommandTemplate> {
+public:
+    /**
+     * Compile a template.
+     * @param json The JSON definition of the command.  Should be a map.
+     */
+    explicit CommandTemplate(const rapidjson::Value& json);
+
+    /**
+     * @param json A JSON command definition.
+     * @return True if the definition has the same keys and scalar values that this template was compiled from.
+     */
+    bool matches(const rapidjson::Value& json) const;
+
+    /**
+     * @param context The data-binding context.
+     * @param json The JSON definition of the command.
+     * @return The evaluated command type.  Empty if no type was given.
+     */
+    std::string type(const Context& context, const rapidjson::Value& json) const;
+
+    /**
+     * @param context The data-binding context.
+     * @param json The JSON definition of the command.
+     * @return The evaluated "when" clause.  True if no clause was given.
+     */
+    bool when(const Context& context, const rapidjson::Value& json) const;
+
+    /**
+     * Build the property bag for one inflation of the command.
+     * @param json The JSON definition of the command.
+     * @param properties Properties passed in from outside.  These take precedence over the command properties.
+     * @return The combined properties.  The "type" and "when" values are not included.
+     */
+    Properties properties(const rapidjson::Value& json, const Properties& properties) const;
+
+    /**
+     * @return True if the command type does not depend on the data-binding context.
+     */
+    bool hasStaticType() const { return mTypeIndex < 0; }
+
+    /**
+     * Store the standard command that the (static) type of this template resolves to.
+     * @param func The command creation function.  May be null if the type is not a standard command.
+     * @param generation The generation of the command factory used to resolve the function.
+     */
+    void setCommandFunc(CommandFunc func, unsigned generation) {
+        mFunc = std::move(func);
+        mFuncGeneration = generation;
+        mFuncResolved = true;
+    }
+
+    /**
+     * @param generation The current generation of the command factory.
+     * @return True if the stored command function is valid for this generation.
+     */
+    bool hasCommandFunc(unsigned generation) const { return mFuncResolved && mFuncGeneration == generation; }
+
+    /**
+     * @return The stored command function.  Check hasCommandFunc() first.
+     */
+    const CommandFunc& commandFunc() const { return mFunc; }
+
+    /**
+     * Retrieve a property value converted by an earlier command built from this template.
+     * @param key The command property key.
+     * @param value The unconverted value of the property in the current command.
+     * @param result Set to the converted value when one is found.
+     * @return True if a converted value was stored for this key from the same unconverted value.
+     */
+    bool getConverted(int key, const Object& value, Object& result) const;
+
+    /**
+     * Remember a converted property value.  It is only stored if the type of the template is
+     * static and the unconverted value is a static property of the template; values passed in
+     * from outside or evaluated from data-binding are ignored.  The conversion must not depend
+     * on the data-binding context.
+     * @param key The command property key.
+     * @param name The name the property was read from.
+     * @param value The unconverted value.
+     * @param converted The converted value.
+     */
+    void setConverted(int key, const std::string& name, const Object& value, const Object& converted);
+
+private:
+    struct Member {
+        std::string name;
+        Object value;   // Scalar values only; arrays and maps are read from the JSON
+        bool nested;
+    };
+
+    std::vector<Member> mMembers;           // In the same order as the JSON
+    Properties mProperties;                 // Scalar properties, excluding "type" and "when"
+    std::vector<size_t> mNested;            // Indices of the array and map members
+    std::string mType;
+    int mTypeIndex = -1;                    // Index of a type that must be evaluated
+    bool mWhen = true;
+    int mWhenIndex = -1;                    // Index of a "when" clause that must be evaluated
+    CommandFunc mFunc;
+    unsigned mFuncGeneration = 0;
+    bool mFuncResolved = false;
+    std::map<int, std::pair<Object, Object>> mConverted;  // Key -> unconverted and converted value
+};
+
+using CommandTemplatePtr = std::shared_ptr<CommandTemplate>;
+
+/**
+ * Cache of compiled command templates for a single document.
+ */
+class CommandTemplateCache {
+public:
+    explicit CommandTemplateCache(size_t sizeLimit) : mTemplates(sizeLimit) {}
+
+    /**
+     * Retrieve the template for a command definition, compiling it if necessary.
+     * @param json The JSON definition of the command.  Should be a map.
+     * @return The command template.
+     */
+    CommandTemplatePtr get(const rapidjson::Value& json);
+
+private:
+    LruCache<const rapidjson::Value*, CommandTemplatePtr> mTemplates;
+};
+
+} // namespace apl
+
+#endif // _APL_COMMAND_TEMPLATE_H
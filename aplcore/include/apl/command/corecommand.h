@@ -17,6 +17,7 @@
 #define _APL_COMMAND_CORE_COMMAND_H
 
 #include "apl/command/command.h"
+#include "apl/command/commandtemplate.h"
 #include "apl/utils/bimap.h"
 #include "apl/primitives/objectbag.h"
 #include "apl/engine/context.h"
@@ -93,6 +94,13 @@ public:
 
     virtual const CommandPropDefSet& propDefSet() const;
 
+    /**
+     * Attach the template this command was built from.  Converted static property values are
+     * shared with other commands built from the same template.
+     * @param commandTemplate The command template.
+     */
+    void setTemplate(const CommandTemplatePtr& commandTemplate) { mTemplate = commandTemplate; }
+
 protected:
     bool validate();
     bool calculateProperties();
@@ -106,6 +114,7 @@ protected:
     CoreComponentPtr  mTarget;
     const bool        mScreenLock;
     std::string       mSequencer;
+    CommandTemplatePtr mTemplate;
  };
 
 } // namespace apl
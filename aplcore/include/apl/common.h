@@ -63,6 +63,7 @@ class ExtensionMediator;
 class GraphicContent;
 class GraphicElement;
 class Graphic;
+class GraphicPathGeometry;
 class GraphicPattern;
 class LiveArray;
 class LiveMap;
@@ -97,6 +98,7 @@ using ExtensionMediatorPtr = std::shared_ptr<ExtensionMediator>;
 using GraphicContentPtr = std::shared_ptr<GraphicContent>;
 using GraphicElementPtr = std::shared_ptr<GraphicElement>;
 using GraphicPtr = std::shared_ptr<Graphic>;
+using GraphicPathGeometryPtr = std::shared_ptr<const GraphicPathGeometry>;
 using GraphicPatternPtr = std::shared_ptr<GraphicPattern>;
 using LiveArrayPtr = std::shared_ptr<LiveArray>;
 using LiveMapPtr = std::shared_ptr<LiveMap>;
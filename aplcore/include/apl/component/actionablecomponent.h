@@ -58,6 +58,7 @@ public:
 
     /// CoreComponent overrides
     bool isActionable() const override { return true; }
+    void trackPointerMove(const PointerEvent& event, apl_time_t timestamp) override;
     bool canConsumeFocusDirectionEvent(FocusDirection direction, bool fromInside) override { return !fromInside; }
     CoreComponentPtr takeFocusFromChild(FocusDirection direction, const Rect& origin) override { return nullptr; }
     CoreComponentPtr getUserSpecifiedNextFocus(FocusDirection direction) override;
@@ -167,7 +167,7 @@ public:
      *
      * This only marks the current component as stale and not any of its children.
      */
-    void markDisplayedChildrenStale(bool useDirtyFlag);
+    virtual void markDisplayedChildrenStale(bool useDirtyFlag);
 
     /**
      * Check if child of a components is in the list of displayed children.
@@ -788,6 +788,14 @@ public:
      */
     virtual PointerCaptureStatus processPointerEvent(const PointerEvent& event, apl_time_t timestamp);
 
+    /**
+     * Record a pointer move that was coalesced into a later move.  Only used for velocity tracking; no gesture
+     * state is changed and no event handlers are run.
+     * @param event pointer move event.
+     * @param timestamp event timestamp.
+     */
+    virtual void trackPointerMove(const PointerEvent& event, apl_time_t timestamp) {}
+
     /**
      * @return The root configuration provided by the viewhost
      */
@@ -889,6 +897,7 @@ protected:
     virtual void attachYogaNode(const CoreComponentPtr& child);
 
     virtual const EventPropertyMap& eventPropertyMap() const;
+    std::shared_ptr<ObjectMap> createEventProperties(const std::string& handler, const Object& value) const;
     virtual void invokeStandardAccessibilityAction(const std::string& name) {}
 
     virtual bool processGestures(const PointerEvent& event, apl_time_t timestamp) { return false; }
@@ -928,12 +937,26 @@ protected:
      */
     virtual void ensureDisplayedChildren();
 
+    /**
+     * The axis-aligned bounding box of a child after its transform has been applied.  This is an
+     * approximation used to decide if the child can be seen; it never excludes a visible child.
+     * @param child A child of this component.
+     * @return The bounding box in the coordinate space of this component.
+     */
+    static Rect displayBoundingBox(const CoreComponent& child);
+
     /**
      * @return True if layout change calculations should not be propagated to component's children. Usually the case
      * when component itself is not taking part in the layout tree.
      */
     bool shouldNotPropagateLayoutChanges() const;
 
+    /**
+     * @return True if processLayoutChanges() must run on every layout pass that reaches this component,
+     * even when Yoga did not lay it out again.  Used by components that do more than track their bounds.
+     */
+    virtual bool alwaysProcessLayoutChanges() const { return false; }
+
     /**
      * @return hash of properties that could affect TextMeasurement.
      */
@@ -991,13 +1014,14 @@ private:
 
     void attachRebuilder(const std::shared_ptr<LayoutRebuilder>& rebuilder) { mRebuilder = rebuilder; }
 
-    std::shared_ptr<ObjectMap> createEventProperties(const std::string& handler, const Object& value) const;
+    void processChildLayoutChanges(bool useDirtyFlag, bool first);
+    bool layoutChangedSinceProcessed() const;
 
     void notifyChildChanged(size_t index, const std::string& uid, const std::string& action);
 
     virtual void attachYogaNodeIfRequired(const CoreComponentPtr& coreChild, int index);
 
-    void scheduleTickHandler(const Object& handler, double delay);
+    void scheduleTickHandler(const Object& handler);
     void processTickHandlers();
 
     /**
@@ -1008,6 +1032,9 @@ private:
 
     YGSize textMeasureInternal(float width, YGMeasureMode widthMode, float height, YGMeasureMode heightMode);
     float textBaselineInternal(float width, float height);
+    // Variants used while layout roots are measured on worker threads
+    YGSize textMeasureConcurrent(float width, YGMeasureMode widthMode, float height, YGMeasureMode heightMode);
+    float textBaselineConcurrent(float width, float height);
 
 protected:
     bool                             mInheritParentState;
@@ -1028,6 +1055,7 @@ private:
     // The members below are used to store cached values for performance reasons, and not part of
     // the state of this component.
     Transform2D                      mGlobalToLocal;
+    Point                            mGlobalToLocalScroll; // Parent scroll position included in mGlobalToLocal
     bool                             mGlobalToLocalIsStale;
     Point                            mStickyOffset;
     bool                             mTextMeasurementHashStale;
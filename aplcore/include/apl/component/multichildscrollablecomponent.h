@@ -41,6 +41,7 @@ public:
     Object getValue() const override;
     bool multiChild() const override { return true; }
     void processLayoutChanges(bool useDirtyFlag, bool first) override;
+    bool alwaysProcessLayoutChanges() const override { return true; }
     void accept(Visitor<CoreComponent>& visitor) const override;
     void raccept(Visitor<CoreComponent>& visitor) const override;
     Point scrollPosition() const override;
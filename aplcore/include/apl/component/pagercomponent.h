@@ -42,6 +42,7 @@ public:
     int pagePosition() const override { return getCalculated(kPropertyCurrentPage).asInt(); }
     bool getTags(rapidjson::Value& outMap, rapidjson::Document::AllocatorType& allocator) override;
     void processLayoutChanges(bool useDirtyFlag, bool first) override;
+    bool alwaysProcessLayoutChanges() const override { return true; }
     bool allowForward() const override;
     bool allowBackwards() const override;
     void release() override;
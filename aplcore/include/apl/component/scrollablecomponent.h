@@ -42,6 +42,8 @@ public:
 
     std::shared_ptr<StickyChildrenTree> getStickyTree() override { return mStickyTree; }
 
+    void markDisplayedChildrenStale(bool useDirtyFlag) override;
+
 protected:
     ScrollableComponent(const ContextPtr& context, Properties&& properties, const Path& path);
 
@@ -51,6 +53,7 @@ protected:
     bool getTags(rapidjson::Value& outMap, rapidjson::Document::AllocatorType& allocator) override;
     bool scrollable() const override { return true; }
     const ComponentPropDefSet& propDefSet() const override;
+    void ensureDisplayedChildren() override;
 
     /**
      * Override this to calculate maximum available scroll position.
@@ -73,9 +76,28 @@ protected:
 private:
     bool setScrollPositionInternal(float value);
     bool canScroll(FocusDirection direction);
+    void updateDisplayCandidates();
+    ContextPtr scrollEventContext();
+
+    struct DisplayCandidate {
+        float leading;   // Leading edge of the bounding box along the scroll axis
+        Rect bounds;     // Bounding box in the coordinate space of this component
+        size_t index;    // Child index
+    };
 
     // A tree of the descendants of this scroll with position: sticky.
     std::shared_ptr<StickyChildrenTree> mStickyTree;
+
+    // Displayable children that are not sticky, sorted by leading edge.  These are cached between
+    // scroll steps; anything other than a scroll position change marks them stale.
+    std::vector<DisplayCandidate> mDisplayCandidates;
+    std::vector<float> mDisplayCandidateReach;   // Running maximum of the candidate trailing edges
+    std::vector<CoreComponentPtr> mStickyCandidates;
+    bool mDisplayCandidatesHorizontal = false;
+    bool mDisplayCandidatesStale = true;
+
+    // Reused by onScroll handlers while no command holds on to it
+    ContextPtr mScrollEventContext;
 };
 
 } // namespace apl
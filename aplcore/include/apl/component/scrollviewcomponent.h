@@ -42,7 +42,6 @@ protected:
 
     bool allowForward() const override;
     bool allowBackwards() const override;
-    void onScrollPositionUpdated() override;
 
 private:
     bool singleChild() const override { return true; }
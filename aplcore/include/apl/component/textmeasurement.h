@@ -37,6 +37,13 @@ struct LayoutSize {
  * to the TextMeasurement object. This will be copied into the root context
  * when inflating a layout, so you can't change the measurement tool for an
  * inflated layout.
+ *
+ * Threading: by default measure() and baseline() are only called from the thread
+ * that drives the RootContext.  If RootProperty::kLayoutWorkerThreads is non-zero,
+ * they may also be called concurrently from layout worker threads, for components
+ * that belong to different layout roots (for example, different Pager pages).  In
+ * that mode the implementation must be thread-safe, and it must only read from the
+ * component passed in.  The core guards its own measurement caches.
  */
 class TextMeasurement {
 public:
@@ -130,6 +130,18 @@ enum RootProperty {
     kTextMeasurementCacheLimit,
     /// Initial display state of the document, used by core prior to any display state updates
     kInitialDisplayState,
+    /// Number of worker threads used to lay out independent layout roots concurrently.  Zero lays out all roots
+    /// on the calling thread.  Non-zero values require a thread-safe TextMeasurement.
+    kLayoutWorkerThreads,
+    /// Apply a configuration change in place when reinflating if the document has not read any of the changed
+    /// viewport or environment values.  The component hierarchy and its state are preserved.  Reads are tracked
+    /// for the document as a whole, so a document that uses vw or vh units, or reads the viewport size in any
+    /// other way, is always fully re-inflated when the viewport size changes.  Reads are only tracked when this
+    /// property is set.
+    kIncrementalReinflation,
+    /// Maximum number of media requests the core media manager leaves outstanding with the runtime.  Further
+    /// requests wait until earlier ones load, fail or are cancelled.  Zero sends every request immediately.
+    kMaxMediaRequestsInFlight,
 };
 
 extern Bimap<int, std::string> sRootPropertyBimap;
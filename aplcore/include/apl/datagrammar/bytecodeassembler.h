@@ -66,6 +66,7 @@ public:
 
 private:
     Object retrieve() const;
+    void recordEnvironmentReads() const;
 
     /*** Methods after this point are for use by the PEGTL parser ***/
 
@@ -161,6 +162,9 @@ private:
     std::vector<ByteCodeInstruction>* mInstructionRef;
     std::vector<Object>* mDataRef;
     std::vector<Operator>* mOperatorsRef;
+
+    // Instruction index and name of each load of the top-level "viewport" or "environment" constant
+    std::vector<std::pair<size_t, std::string>> mEnvironmentLoads;
 };
 
 } // namespace datagrammar
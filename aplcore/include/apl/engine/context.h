@@ -48,6 +48,7 @@ class Event;
 class Sequencer;
 class RootConfig;
 class DataSourceConnection;
+class CommandTemplateCache;
 
 class FocusManager;
 class HoverManager;
@@ -58,6 +59,35 @@ class LayoutManager;
 
 using DataSourceConnectionPtr = std::shared_ptr<DataSourceConnection>;
 
+/**
+ * Flags for the "viewport" and "environment" values read by a document.  The values that configuration
+ * changes modify most often have their own flag; the remaining values of each object share a flag.
+ */
+enum EnvironmentReadFlags : unsigned {
+    kEnvironmentReadViewportWidth = 1u << 0,
+    kEnvironmentReadViewportHeight = 1u << 1,
+    kEnvironmentReadViewportDpi = 1u << 2,
+    kEnvironmentReadViewportPixelWidth = 1u << 3,
+    kEnvironmentReadViewportPixelHeight = 1u << 4,
+    kEnvironmentReadViewportOther = 1u << 5,
+    kEnvironmentReadFontScale = 1u << 6,
+    kEnvironmentReadScreenMode = 1u << 7,
+    kEnvironmentReadScreenReader = 1u << 8,
+    kEnvironmentReadReason = 1u << 9,
+    kEnvironmentReadEnvironmentOther = 1u << 10,
+
+    kEnvironmentReadViewport = (1u << 6) - 1,
+    kEnvironmentReadEnvironment = ((1u << 11) - 1) & ~kEnvironmentReadViewport,
+};
+
+/**
+ * Look up the read flag of a "viewport" or "environment" value.
+ * @param name The name of the object, either "viewport" or "environment".
+ * @param field The name of the value in the object.  An empty field means the entire object.
+ * @return The matching EnvironmentReadFlags, or zero if the name is not recognized.
+ */
+unsigned environmentReadFlags(const std::string& name, const std::string& field);
+
 /*
  * The data-binding context holds information about the local environment, metrics, and resources.
  * Context objects should be heap-allocated with a shared pointer to their parent context.
@@ -448,6 +478,32 @@ public:
      */
     double pxToDp(double px) const;
 
+    /**
+     * @return True if the document's reads of "viewport" and "environment" values are being recorded.
+     *         They are only recorded when RootProperty::kIncrementalReinflation is set.
+     */
+    bool trackEnvironmentReads() const;
+
+    /**
+     * Note that the document read "viewport" or "environment" values.  The root context uses these
+     * records to decide if a configuration change can be applied without re-inflating the document.
+     * @param flags The EnvironmentReadFlags of the values read.
+     */
+    void recordEnvironmentRead(unsigned flags) const;
+
+    /**
+     * Replace a constant value in this context.  This is used to update the "viewport" and "environment"
+     * constants after a configuration change has been applied in place.  Expressions that have already
+     * been evaluated are not updated.
+     * @param key The string key name
+     * @param value The new value
+     */
+    void updateConstant(const std::string& key, const Object& value)
+    {
+        mMap.erase(key);
+        mMap.emplace(key, ContextObject(value));
+    }
+
     /**
      * @return The height of the viewport in dp
      */
@@ -559,6 +615,16 @@ public:
      */
     LruCache<TextMeasureRequest, float>& cachedBaselines();
 
+    /**
+     * @return compiled command templates for this document.
+     */
+    CommandTemplateCache& commandTemplates();
+
+    /**
+     * @return compiled vector graphic path geometry for this document.
+     */
+    LruCache<std::string, GraphicPathGeometryPtr>& pathGeometries();
+
     /**
      * @return List of pending onMount handlers for recently inflated components.
      */
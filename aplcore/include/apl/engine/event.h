@@ -178,6 +178,20 @@ enum EventType {
      * Does not have an ActionRef
      */
     kEventTypeOpenKeyboard,
+
+    /**
+     * The document no longer needs external media that was requested earlier and has not finished
+     * loading.  Only issued when @c ExperimentalFeature::kExperimentalFeatureManageMediaRequests is
+     * enabled and RootProperty::kMaxMediaRequestsInFlight is set.
+     *
+     * kEventPropertySource: the source URIs that are no longer needed
+     * kEventPropertyMediaType: the type of media being cancelled
+     *
+     * Does not have an ActionRef
+     *
+     * Note: Runtime may stop loading the media.  A later call to RootContext::mediaLoaded is ignored.
+     */
+    kEventTypeMediaCancel,
 };
 
 enum EventProperty {
@@ -0,0 +1,73 @@
+/**
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#ifndef _APL_EVENT_QUEUE_H
+#define _APL_EVENT_QUEUE_H
+
+#include <vector>
+
+#include "apl/engine/event.h"
+
+namespace apl {
+
+/**
+ * First-in, first-out queue of events held in one contiguous block.  Popped events are not erased
+ * one at a time; the storage is reset once the queue empties, so a queue that is drained each frame
+ * reuses the same memory and does not allocate per event.
+ */
+class EventQueue {
+public:
+    /**
+     * @return True if there are no queued events.
+     */
+    bool empty() const { return mHead == mEvents.size(); }
+
+    /**
+     * @return The number of queued events.
+     */
+    size_t size() const { return mEvents.size() - mHead; }
+
+    /**
+     * Add an event to the back of the queue.
+     * @param event The event.
+     */
+    void push(Event&& event);
+
+    /**
+     * Remove the event at the front of the queue.  The queue must not be empty.
+     * @return The event.
+     */
+    Event pop();
+
+    /**
+     * Move every queued event onto the end of a vector, leaving the queue empty.
+     * @param events The vector to append the events to.
+     * @return The number of events appended.
+     */
+    size_t drain(std::vector<Event>& events);
+
+    /**
+     * Discard all queued events.
+     */
+    void clear();
+
+private:
+    std::vector<Event> mEvents;
+    size_t mHead = 0;   // Index of the front event; everything before it has been popped
+};
+
+} // namespace apl
+
+#endif // _APL_EVENT_QUEUE_H
@@ -16,8 +16,12 @@
 #ifndef _APL_LAYOUT_MANAGER_H
 #define _APL_LAYOUT_MANAGER_H
 
+#include <chrono>
 #include <set>
 #include <map>
+#include <memory>
+#include <mutex>
+#include <vector>
 
 #include "apl/common.h"
 #include "apl/primitives/object.h"
@@ -28,6 +32,7 @@ namespace apl {
 
 class RootContextData;
 class ConfigurationChange;
+class WorkerPool;
 
 /**
  * The LayoutManager keeps track of which components have properties that have changed and need to have
@@ -60,11 +65,26 @@ class ConfigurationChange;
  * the MultiChildScrollableComponent keeps an "ensured range" of children which have Yoga nodes attached
  * to the node hierarchy.  As the component scrolls the ensured range is updated and additional nodes
  * are attached to the hierarchy.
+ *
+ * Concurrent layout
+ *
+ * Pending components with no pending ancestor are the tops of disjoint Yoga hierarchies.  When
+ * RootProperty::kLayoutWorkerThreads is non-zero, the Yoga calculations for those components run
+ * concurrently on a pool of worker threads that lives as long as the document.  Everything else (pre-layout processing, processing the layout
+ * changes, and laying out components whose ancestors were also pending) runs afterwards on the
+ * calling thread, in top-to-bottom order.  Text measurement callbacks made during the concurrent
+ * phase must use measurementLock() to guard shared state, and must not trace or log.
+ *
+ * Yoga keeps a global layout generation counter.  The bundled Yoga is patched to make it atomic;
+ * concurrent layout is not safe with an unpatched external Yoga library.
  */
 
 class LayoutManager {
 public:
+    using Clock = std::chrono::steady_clock;
+
     explicit LayoutManager(const RootContextData& core);
+    ~LayoutManager();
 
     /**
      * Stop all layout processing (and future layout processing)
@@ -89,6 +109,24 @@ public:
      */
     void layout(bool useDirtyFlag, bool first = false);
 
+    /**
+     * Set a deadline for the work that follows.  Once the deadline has passed, layout roots that are not
+     * displayed (cached pager pages) are left pending and scrollable components lay out only the children
+     * in view, deferring their child cache to the next frame.
+     * @param deadline The time at which deferrable work should stop.
+     */
+    void setDeadline(Clock::time_point deadline) { mDeadline = deadline; mHasDeadline = true; }
+
+    /**
+     * Remove the deadline set by setDeadline().
+     */
+    void clearDeadline() { mHasDeadline = false; }
+
+    /**
+     * @return True if a deadline is set and has passed.
+     */
+    bool pastDeadline() const { return mHasDeadline && Clock::now() >= mDeadline; }
+
     /**
      * Flash any non-inflated components in hierarchy, where supported.
      */
@@ -149,9 +187,54 @@ public:
      */
     void needToReProcessLayoutChanges() { mNeedToReProcessLayoutChanges = true; }
 
+    /**
+     * Layout change statistics, collected from the start of the most recent layout pass.
+     */
+    struct PassStatistics {
+        size_t visited = 0;     // Components that processed layout changes
+        size_t changed = 0;     // Components whose bounds or inner bounds changed
+        size_t concurrent = 0;  // Yoga calculations shared with the layout worker threads
+        size_t threads = 0;     // Most threads used by a single concurrent calculation phase
+    };
+
+    /**
+     * Record that a component has processed its layout changes.
+     * @param changed True if the bounds or inner bounds of the component changed.
+     */
+    void recordLayoutChange(bool changed) {
+        mPassStatistics.visited++;
+        if (changed)
+            mPassStatistics.changed++;
+    }
+
+    /**
+     * @return Statistics for the most recent layout pass
+     */
+    const PassStatistics& passStatistics() const { return mPassStatistics; }
+
+    /**
+     * Guard state shared by text measurement callbacks.  The lock is only taken while Yoga
+     * calculations are running concurrently.
+     * @return A lock, which may not own the mutex.
+     */
+    std::unique_lock<std::mutex> measurementLock() {
+        return mConcurrent ? std::unique_lock<std::mutex>(mMeasurementMutex) : std::unique_lock<std::mutex>();
+    }
+
+    /**
+     * @return True while Yoga calculations are running on the layout worker threads.  Code on the
+     *         measurement path must not trace or log while this is set.
+     */
+    bool isConcurrent() const { return mConcurrent; }
+
 private:
     void layoutComponent(const CoreComponentPtr& component, bool useDirtyFlag, bool first);
+    void layoutConcurrently(const std::vector<CoreComponentPtr>& components, size_t workers,
+                            bool useDirtyFlag, bool first);
+    bool layoutSize(const CoreComponentPtr& component, Size& size) const;
+    void processLayout(const CoreComponentPtr& component, bool useDirtyFlag, bool first);
     void flushLazyInflationInternal(const CoreComponentPtr& comp);
+    bool deferLayout(const CoreComponentPtr& component) const;
 
 private:
     using PPKey = std::pair<CoreComponentPtr, PropertyKey>;
@@ -163,6 +246,12 @@ private:
     bool mInLayout = false;    // Guard against recursive calls to layout
     bool mNeedToReProcessLayoutChanges = false;
     std::map<PPKey, Object> mPostProcess;   // Collection of elements to post-process
+    PassStatistics mPassStatistics;
+    bool mConcurrent = false;   // True while Yoga calculations run on worker threads
+    std::mutex mMeasurementMutex;
+    std::unique_ptr<WorkerPool> mWorkerPool;    // Created on first concurrent layout
+    Clock::time_point mDeadline;
+    bool mHasDeadline = false;
 };
 
 } // namespace apl
@@ -48,26 +48,41 @@ public:
     Dimension asAbsoluteDimension(const Context& context, const char *name, double defvalue);
 
     void emplace(const Object& item);
-    void emplace(const std::string& name, const Object& value) { mProperties.emplace(name, value); }
+    void emplace(const std::string& name, const Object& value) { mutableProperties().emplace(name, value); }
+
+    /**
+     * Add all of the properties from another property bag.  Existing properties are not overwritten.
+     * Copying into an empty property bag shares the storage of the other bag until either one is modified.
+     * @param other The property bag to copy from.
+     */
+    void emplace(const Properties& other);
 
     void addToContext(const ContextPtr &context, const Parameter &parameter, bool userWriteable);
 
-    ObjectMap::const_iterator find(const char *name) const { return mProperties.find(name); }
-    ObjectMap::const_iterator find(const std::string& name) const { return mProperties.find(name); }
+    bool empty() const { return properties().empty(); }
+    size_t size() const { return properties().size(); }
+
+    ObjectMap::const_iterator find(const char *name) const { return properties().find(name); }
+    ObjectMap::const_iterator find(const std::string& name) const { return properties().find(name); }
     ObjectMap::const_iterator find(const std::vector<std::string>& names) const {
+        const auto& map = properties();
         for (const auto& name : names) {
-            auto it = mProperties.find(name);
-            if (it != mProperties.end())
+            auto it = map.find(name);
+            if (it != map.end())
                 return it;
         }
-        return mProperties.end();
+        return map.end();
     }
 
-    ObjectMap::const_iterator begin() const { return mProperties.begin(); }
-    ObjectMap::const_iterator end() const { return mProperties.end(); }
+    ObjectMap::const_iterator begin() const { return properties().begin(); }
+    ObjectMap::const_iterator end() const { return properties().end(); }
 
 private:
-    ObjectMap mProperties;
+    const ObjectMap& properties() const;
+    ObjectMap& mutableProperties();
+
+    // Copies of a property bag share storage; the storage is cloned on the first modification.
+    std::shared_ptr<ObjectMap> mProperties;
 };
 
 } // namespace apl
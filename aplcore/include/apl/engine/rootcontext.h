@@ -43,6 +43,7 @@ class RootConfig;
 class RootContextData;
 class TimeManager;
 struct PointerEvent;
+struct PointerSample;
 
 /**
  * Represents a top-level APL document.
@@ -143,6 +144,12 @@ public:
      * component hierarchy.  After calling this method the view host should rebuild its visual hierarchy.
      *
      * This method should be called by the view host when it receives a Reinflate (kEventTypeReinflate) event.
+     *
+     * If RootProperty::kIncrementalReinflation is set and the document has not read any of the viewport or
+     * environment values that were changed, the change is applied to the existing component hierarchy.  The
+     * top component is retained, so the view host can compare topComponent() before and after this call to
+     * decide if the visual hierarchy must be rebuilt.  Reads are tracked for the whole document: any use of the
+     * viewport size, including vw and vh units, means that a change of viewport size re-inflates the document.
      */
     void reinflate();
 
@@ -159,6 +166,17 @@ public:
      */
     void clearPending() const;
 
+    /**
+     * Clear pending work, stopping once the time budget is spent.  Data changes, timers, onMount handlers
+     * and the layout of what is on screen always complete.  Once the budget is spent, layout roots that are
+     * not displayed (such as cached pager pages) are left for a later call and sequences fill their child
+     * cache on the next frame.  Calling clearPending(), hasEvent(), popEvent() or isDirty() finishes any
+     * remaining layout.
+     * @param budget The time budget in milliseconds.
+     * @return True if work was left for a later call.
+     */
+    bool clearPending(apl_duration_t budget) const;
+
     /**
      * @return True if there is at least one queued event to be processed.
      */
@@ -169,6 +187,15 @@ public:
      */
     Event popEvent();
 
+    /**
+     * Remove all queued events at once.  The events are appended to the vector in the order
+     * they would have been returned by popEvent().  A view host that keeps the vector between
+     * frames avoids allocating a new one each frame.
+     * @param events The vector to append the events to.
+     * @return The number of events appended.
+     */
+    size_t drainEvents(std::vector<Event>& events);
+
     /**
      * Public constructor.  Use the ::create method instead.
      * @param metrics Display metrics
@@ -383,6 +410,20 @@ public:
      */
     bool handlePointerEvent(const PointerEvent& pointerEvent);
 
+    /**
+     * Handle a batch of timestamped pointer samples with coordinates relative to the viewport, in the order they
+     * were sampled.  Consecutive move samples from the same pointer are coalesced: every sample contributes to
+     * fling velocity estimation, but hit testing, gesture processing and the onMove handlers run only once, on the
+     * final sample of the run.  All other events are handled individually, as in handlePointerEvent.
+     *
+     * Sample timestamps use the same time base as updateTime().  Timestamps later than the current time are
+     * treated as the current time.
+     *
+     * @param samples The pointer samples to handle.
+     * @return true if any of the handled events was consumed and should not be passed through any platform handling.
+     */
+    bool handlePointerEvents(const std::vector<PointerSample>& samples);
+
     /**
      * An update message from the viewhost called when a key is pressed.  The
      * keyboard message is directed to the focused component, or the document
@@ -486,11 +527,12 @@ public:
 private:
     void init(const Metrics& metrics, const RootConfig& config, bool reinflation);
     bool setup(const CoreComponentPtr& top);
+    bool reinflateInPlace(const Metrics& metrics, const RootConfig& config);
     bool verifyAPLVersionCompatibility(const std::vector<std::shared_ptr<Package>>& ordered,
                                        const APLVersion& compatibilityVersion);
     bool verifyTypeField(const std::vector<std::shared_ptr<Package>>& ordered, bool enforce);
     ObjectMapPtr createDocumentEventProperties(const std::string& handler) const;
-    void scheduleTickHandler(const Object& handler, double delay);
+    void scheduleTickHandler(const Object& handler);
     void processTickHandlers();
     void clearPendingInternal(bool first) const;
 
@@ -18,14 +18,15 @@
 
 #include <map>
 #include <string>
-#include <queue>
 
+#include "apl/command/commandtemplate.h"
 #include "apl/content/content.h"
 #include "apl/content/metrics.h"
 #include "apl/content/rootconfig.h"
 #include "apl/content/settings.h"
 #include "apl/datasource/datasourceconnection.h"
 #include "apl/engine/event.h"
+#include "apl/engine/eventqueue.h"
 #include "apl/engine/hovermanager.h"
 #include "apl/engine/jsonresource.h"
 #include "apl/engine/keyboardmanager.h"
@@ -138,11 +139,41 @@ public:
      */
     LruCache<TextMeasureRequest, float>& cachedBaselines() { return mCachedBaselines; }
 
+    /**
+     * @return compiled command templates, keyed by the JSON definition of the command.
+     */
+    CommandTemplateCache& commandTemplates() { return mCommandTemplates; }
+
+    /**
+     * @return compiled vector graphic path geometry, keyed by the path data string.
+     */
+    LruCache<std::string, GraphicPathGeometryPtr>& pathGeometries() { return mPathGeometries; }
+
     /**
      * @return List of pending onMount handlers for recently inflated components.
      */
     WeakPtrSet<CoreComponent>& pendingOnMounts() { return mPendingOnMounts; }
 
+    /**
+     * @return True if reads of "viewport" and "environment" values are recorded.  This is only done when
+     *         RootProperty::kIncrementalReinflation is set.
+     */
+    bool trackEnvironmentReads() const { return mTrackEnvironmentReads; }
+
+    /**
+     * Record that the document read "viewport" or "environment" values.
+     * @param flags The EnvironmentReadFlags of the values read.
+     */
+    void recordEnvironmentRead(unsigned flags) {
+        if (mTrackEnvironmentReads)
+            mEnvironmentReads |= flags;
+    }
+
+    /**
+     * @return The EnvironmentReadFlags of the values read by the document since this data was created.
+     */
+    unsigned environmentReads() const { return mEnvironmentReads; }
+
 public:
     int getPixelWidth() const { return mMetrics.getPixelHeight(); }
     int getPixelHeight() const { return mMetrics.getPixelHeight(); }
@@ -157,9 +188,9 @@ public:
     LayoutDirection getLayoutDirection() const { return mLayoutDirection; }
     bool getReinflationFlag() const { return mRuntimeState.getReinflation(); }
 
-    std::queue<Event> events;
+    EventQueue events;
 #ifdef ALEXAEXTENSIONS
-    std::queue<Event> extesnionEvents;
+    EventQueue extesnionEvents;
 #endif
     std::set<ComponentPtr> dirty;
     std::set<ComponentPtr> dirtyVisualContext;
@@ -183,7 +214,7 @@ private:
     YGConfigRef mYGConfigRef;
     TextMeasurementPtr mTextMeasurement;
     CoreComponentPtr mTop;         // The top component
-    const RootConfig mConfig;
+    RootConfig mConfig;
     int mScreenLockCount;
     SettingsPtr mSettings;
     SessionPtr mSession;
@@ -191,7 +222,11 @@ private:
     LayoutDirection mLayoutDirection;
     LruCache<TextMeasureRequest, YGSize> mCachedMeasures;
     LruCache<TextMeasureRequest, float> mCachedBaselines;
+    CommandTemplateCache mCommandTemplates;
+    LruCache<std::string, GraphicPathGeometryPtr> mPathGeometries;
     WeakPtrSet<CoreComponent> mPendingOnMounts;
+    bool mTrackEnvironmentReads;
+    unsigned mEnvironmentReads = 0;
 };
 
 
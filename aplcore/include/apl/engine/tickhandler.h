@@ -0,0 +1,56 @@
+/**
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#ifndef _APL_TICK_HANDLER_H
+#define _APL_TICK_HANDLER_H
+
+#include "apl/engine/context.h"
+#include "apl/primitives/object.h"
+
+namespace apl {
+
+/**
+ * A "handleTick" handler prepared for repeated execution.  The delay is calculated once and the
+ * command list is array-ified once unless it contains data-bound elements.  The "when" clause is
+ * evaluated on every tick.
+ */
+class TickHandler {
+public:
+    /**
+     * @param context The data-binding context used to calculate the delay.
+     * @param handler The tick handler definition.
+     */
+    TickHandler(const Context& context, const Object& handler);
+
+    /**
+     * @return The time between ticks.
+     */
+    apl_duration_t delay() const { return mDelay; }
+
+    /**
+     * @param context The tick event context.
+     * @return The commands to execute on this tick.  Empty if the "when" clause is false.
+     */
+    Object commands(const Context& context) const;
+
+private:
+    Object mHandler;
+    Object mCommands;   // Null if the command list must be array-ified on each tick
+    apl_duration_t mDelay;
+};
+
+} // namespace apl
+
+#endif // _APL_TICK_HANDLER_H
@@ -114,6 +114,14 @@ public:
      */
     virtual bool hasChildren() const { return false; }
 
+    /**
+     * Retrieve the compiled geometry of this element.  Only path elements have geometry.
+     * The geometry object is replaced (and kGraphicPropertyPathData is marked dirty) whenever
+     * the path data changes, so view hosts may cache rendering resources against the pointer.
+     * @return The compiled path geometry or nullptr if this element has no geometry.
+     */
+    virtual GraphicPathGeometryPtr getPathGeometry() const { return nullptr; }
+
     /**
      * Do any VectorGraphic or context dependent clean-up.
      */
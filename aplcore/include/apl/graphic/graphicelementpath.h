@@ -28,10 +28,16 @@ public:
     GraphicElementPath(const GraphicPtr& graphic, const ContextPtr& context) : GraphicElement(graphic, context) {}
     GraphicElementType getType() const override { return kGraphicElementTypePath; }
     std::string toDebugString() const override { return "GraphicElementPath<>"; }
+    GraphicPathGeometryPtr getPathGeometry() const override { return mGeometry; }
 
 protected:
     const GraphicPropDefSet& propDefSet() const override;
     bool initialize(const GraphicPtr& graphic, const Object& json) override;
+
+    static void fixPathGeometry(GraphicElement& element);
+
+private:
+    GraphicPathGeometryPtr mGeometry;
 };
 
 } // namespace apl
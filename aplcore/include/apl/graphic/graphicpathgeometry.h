@@ -0,0 +1,122 @@
+/**
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#ifndef _APL_GRAPHIC_PATH_GEOMETRY_H
+#define _APL_GRAPHIC_PATH_GEOMETRY_H
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "apl/common.h"
+#include "apl/primitives/rect.h"
+#include "apl/utils/counter.h"
+#include "apl/utils/noncopyable.h"
+
+namespace apl {
+
+/**
+ * Commands stored in a compiled path.  Each command consumes a fixed number of points
+ * from the point buffer (listed below as x,y pairs).  All coordinates are absolute.
+ */
+enum GraphicPathCommand : uint8_t {
+    /// Start a new sub-path (1 point)
+    kGraphicPathCommandMoveTo,
+    /// Straight line from the current point (1 point)
+    kGraphicPathCommandLineTo,
+    /// Quadratic Bézier curve: control point, end point (2 points)
+    kGraphicPathCommandQuadTo,
+    /// Cubic Bézier curve: first control point, second control point, end point (3 points)
+    kGraphicPathCommandCubicTo,
+    /// Close the current sub-path (0 points)
+    kGraphicPathCommandClose
+};
+
+/**
+ * A compiled representation of an AVG/SVG path string.  The path is reduced to a compact
+ * buffer of absolute move, line, quadratic, cubic, and close commands with a parallel buffer
+ * of floating-point coordinates.  Relative commands, horizontal/vertical lines, smooth curves
+ * and elliptical arcs are all normalized during compilation (arcs become cubic curves).
+ *
+ * The bounding box and total length of the path are calculated once at compilation time.
+ * The bounds are the exact bounds of the geometry, not of the control points.
+ *
+ * Compiled paths are immutable.  Each document keeps a bounded cache of recently compiled paths,
+ * so calling create() twice with the same context and path string usually returns the same object.
+ */
+class GraphicPathGeometry : public NonCopyable,
+                            public Counter<GraphicPathGeometry> {
+public:
+    /**
+     * Compile a path string or retrieve it from the path cache of the document.  Parsing stops at
+     * the first malformed command; everything before that point is retained.
+     * @param context The data-binding context of the document.
+     * @param pathData The path string
+     * @return The compiled geometry.  This is never null.
+     */
+    static GraphicPathGeometryPtr create(Context& context, const std::string& pathData);
+
+    /**
+     * Compile a path string without caching it.
+     * @param pathData The path string
+     * @return The compiled geometry.  This is never null.
+     */
+    static GraphicPathGeometryPtr create(const std::string& pathData);
+
+    /**
+     * Constructor.  Use create() instead.
+     */
+    explicit GraphicPathGeometry(const std::string& pathData);
+
+    /**
+     * @return The command buffer.
+     */
+    const std::vector<GraphicPathCommand>& getCommands() const { return mCommands; }
+
+    /**
+     * @return The point buffer.  Points are stored as consecutive x,y pairs.
+     */
+    const std::vector<float>& getPoints() const { return mPoints; }
+
+    /**
+     * @return The tight bounding box of the path.  An empty path has empty bounds at the origin.
+     */
+    const Rect& getBounds() const { return mBounds; }
+
+    /**
+     * @return The total length of all drawn segments in the path, in viewport units.
+     */
+    float getLength() const { return mLength; }
+
+    /**
+     * @return True if the path contains no drawing commands.
+     */
+    bool empty() const { return mCommands.empty(); }
+
+    std::string toDebugString() const;
+
+private:
+    void calculateMetrics();
+
+private:
+    std::vector<GraphicPathCommand> mCommands;
+    std::vector<float> mPoints;
+    Rect mBounds;
+    float mLength = 0;
+};
+
+} // namespace apl
+
+#endif // _APL_GRAPHIC_PATH_GEOMETRY_H
@@ -34,7 +34,7 @@ public:
     static LiveMapChange replace() { return {REPLACE, ""}; }
 
     Command command() const { return mCommand; }
-    std::string key() const { return mKey; }
+    const std::string& key() const { return mKey; }
 
 private:
     LiveMapChange(Command command, const std::string& key)
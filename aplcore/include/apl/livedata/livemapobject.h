@@ -70,6 +70,9 @@ public:
     void flush() override;
 
     /**
+     * Repeated SET operations on a key are coalesced until the next flush: only the first SET is
+     * recorded, and the new value is read from the map.  Extensions that report uncollapsed
+     * updates therefore send one update event per key per flush, not one per SET.
      * @return list of changes processed for this map.
      */
     const std::vector<LiveMapChange>& getChanges();
@@ -86,6 +89,7 @@ private:
     LiveMapPtr mLiveMap;
     std::vector<LiveMapChange> mChanges;
     std::set<std::string> mChanged;
+    std::set<std::string> mPendingSets;  // Keys whose most recent unflushed change is a SET
 };
 
 } // namespace apl
@@ -18,7 +18,7 @@
 
 #include <map>
 #include <memory>
-#include <set>
+#include <vector>
 
 #include "apl/media/mediamanager.h"
 
@@ -27,6 +27,11 @@ namespace apl {
 /**
  * The core media manager pushes events onto the event queue when media objects are requested.
  *
+ * Pending requests are sent closest to the viewport first, measured from the components that requested them.
+ * When RootProperty::kMaxMediaRequestsInFlight is set, the manager sends no more than that many requests
+ * until the runtime reports them loaded or failed.  A request that is still loading when the last media object
+ * using it is released is cancelled with a kEventTypeMediaCancel event and no longer counts against the limit.
+ *
  * This media manager is not thread safe and should not be used by multiple view hosts (create one per view host).
  * This is the default media manager that will be instantiated in RootConfig if not overwritten.
  */
@@ -36,6 +41,8 @@ public:
 
     MediaObjectPtr request(const std::string& url, EventMediaType type) override;
 
+    MediaObjectPtr request(const std::string& url, EventMediaType type, const ComponentPtr& component) override;
+
     void processMediaRequests(const ContextPtr& context) override;
 
     void mediaLoadComplete(const std::string& source,
@@ -51,8 +58,22 @@ public:
     void removeMediaObject(const std::string& url);
 
 protected:
+    /**
+     * A media object that has not been requested from the runtime yet.
+     */
+    struct PendingRequest {
+        std::weak_ptr<MediaObject> object;
+        std::vector<std::weak_ptr<Component>> components;  // Components that asked for the media object
+        size_t order;                                        // Breaks ties between equally distant requests
+    };
+
+    void sendCancellations(const ContextPtr& context);
+
     std::map<std::string, std::weak_ptr<MediaObject>> mObjectMap;
-    std::set<std::weak_ptr<MediaObject>, std::owner_less<std::weak_ptr<MediaObject>>> mPending;
+    std::map<std::string, PendingRequest> mPending;
+    std::map<std::string, EventMediaType> mInFlight;   // Only tracked when there is a limit on requests
+    std::map<std::string, EventMediaType> mCancelled;  // In-flight requests that are no longer needed
+    size_t mRequestOrder = 0;
 };
 
 } // namespace apl
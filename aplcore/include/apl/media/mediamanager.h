@@ -43,6 +43,18 @@ public:
      */
     virtual MediaObjectPtr request(const std::string& url, EventMediaType type) = 0;
 
+    /**
+     * Request a media object for display in a component.  Media managers may use the component
+     * to decide which requests to send first.  The default implementation ignores the component.
+     * @param url The source required
+     * @param type The type of media requested.
+     * @param component The component that will display the media object.
+     * @return the media object
+     */
+    virtual MediaObjectPtr request(const std::string& url, EventMediaType type, const ComponentPtr& component) {
+        return request(url, type);
+    }
+
     /**
      * Go though current list of registered components and generate requests to load all required sources.
      * This method is called from the main event loop.  Override this method if your media manager needs
@@ -16,7 +16,10 @@
 #ifndef _APL_OBJECT_BAG_H
 #define _APL_OBJECT_BAG_H
 
+#include <algorithm>
 #include <map>
+#include <stdexcept>
+#include <vector>
 
 #include "apl/utils/bimap.h"
 #include "object.h"
@@ -25,33 +28,49 @@ namespace apl {
 
 using Mapper = Bimap<int, std::string>;
 
+/**
+ * A small set of values keyed by an enumerated property.  The values are kept sorted by key in a single
+ * contiguous block, since a bag rarely holds more than a handful of values.
+ */
 template<Mapper& mapper>
 class ObjectBag {
 private:
-    std::map<int, Object> mValues;
+    using Storage = std::vector<std::pair<int, Object>>;
+    Storage mValues;
+
+    static bool keyLess(const std::pair<int, Object>& lhs, int rhs) { return lhs.first < rhs; }
 
 public:
     ObjectBag() {}
-    ObjectBag(std::map<int, Object>&& values) : mValues(std::move(values)) {}
+    ObjectBag(std::map<int, Object>&& values) : mValues(values.begin(), values.end()) {}
 
-    auto emplace(const std::string& key, Object value)
-            -> decltype(mValues.emplace(mapper.at(key), std::move(value)))
+    std::pair<typename Storage::iterator, bool> emplace(const std::string& key, Object value)
     {
-        return mValues.emplace(mapper.at(key), std::move(value));
+        return emplace(mapper.at(key), std::move(value));
     }
 
-    auto emplace(int key, Object value)
-            -> decltype(mValues.emplace(key, std::move(value)))
+    std::pair<typename Storage::iterator, bool> emplace(int key, Object value)
     {
-        return mValues.emplace(key, std::move(value));
+        auto it = std::lower_bound(mValues.begin(), mValues.end(), key, keyLess);
+        if (it != mValues.end() && it->first == key)
+            return { it, false };
+        return { mValues.emplace(it, key, std::move(value)), true };
     }
 
-    const Object& at(int index) const { return mValues.at(index); }
-    const Object& at(const char *name) const { return mValues.at(mapper.at(name)); }
+    const Object& at(int index) const {
+        auto it = find(index);
+        if (it == end())
+            throw std::out_of_range("ObjectBag::at");
+        return it->second;
+    }
+    const Object& at(const char *name) const { return at(mapper.at(name)); }
 
-    typename std::map<int, Object>::const_iterator find(int index) const { return mValues.find(index); }
-    typename std::map<int, Object>::const_iterator begin() const { return mValues.begin(); }
-    typename std::map<int, Object>::const_iterator end() const { return mValues.end(); }
+    typename Storage::const_iterator find(int index) const {
+        auto it = std::lower_bound(mValues.begin(), mValues.end(), index, keyLess);
+        return it != mValues.end() && it->first == index ? it : mValues.end();
+    }
+    typename Storage::const_iterator begin() const { return mValues.begin(); }
+    typename Storage::const_iterator end() const { return mValues.end(); }
 
     unsigned int size() const { return mValues.size(); }
 
@@ -17,9 +17,11 @@
 #define _APL_CORE_TIME_MANAGER_H
 
 #include <algorithm>
-#include <vector>
-#include <limits>
 #include <atomic>
+#include <deque>
+#include <limits>
+#include <unordered_map>
+#include <vector>
 
 #include "apl/time/timemanager.h"
 
@@ -27,6 +29,11 @@ namespace apl {
 
 /**
  * A heap-based implementation of a TimeManager.
+ *
+ * Timers are stored in recycled slots and found by id through a hash map.  The heap holds only
+ * the end time, scheduling order and slot of each timer; cancelling a timer releases its slot and leaves a stale
+ * heap entry behind that is discarded when it reaches the top.  Running animators are kept on an
+ * intrusive list so that each frame visits them in place.
  */
 class CoreTimeManager : public TimeManager {
 public:
@@ -41,7 +48,8 @@ public:
 
     /****** Methods from TimeManager *******/
 
-    int size() const override { return mTimerHeap.size(); }
+    timeout_id setInterval(Ticker ticker, apl_duration_t interval) override;
+    int size() const override { return mSlotById.size(); }
     void updateTime(apl_time_t updatedTime) override;
     apl_time_t nextTimeout() override;
     apl_time_t currentTime() const override { return mTime; }
@@ -54,25 +62,52 @@ protected:
     void advanceToNext();
 
 protected:
-    // Hold regular timers until they fire
-    struct TimeoutTuple {
-        TimeoutTuple(Runnable runnable, Animator animator, apl_time_t startTime, apl_duration_t duration, timeout_id id)
-            : runnable(runnable), animator(animator), startTime(startTime), endTime(startTime + duration), id(id) {}
+    static constexpr size_t NO_SLOT = std::numeric_limits<size_t>::max();
 
+    // A single timeout, animator, or interval.  Slots are reused once released.
+    struct TimerSlot {
         Runnable runnable;
         Animator animator;
-        apl_time_t startTime;
+        Ticker ticker;
+        apl_time_t startTime = 0;
+        apl_time_t endTime = 0;
+        apl_duration_t interval = 0;    // Only used by tickers
+        timeout_id id = 0;              // Zero once the slot has been released
+        size_t prevAnimator = NO_SLOT;
+        size_t nextAnimator = NO_SLOT;
+        unsigned pass = 0;              // Animator pass in which the animator was started
+        bool running = false;           // The slot callback is executing; defer recycling
+    };
+
+    // The heap holds small entries that refer to the timer slots.  Timers that end at the same time
+    // fire in heap order, which depends on every push, pop and removal; cancelled timers are erased
+    // and the heap rebuilt, as the original tuple heap did, so that order is unchanged.
+    struct HeapEntry {
         apl_time_t endTime;
+        size_t slot;
         timeout_id id;
 
-        bool operator<(const TimeoutTuple& rhs) const {
+        bool operator<(const HeapEntry& rhs) const {
             return endTime > rhs.endTime;  // Reverse the order deliberately
         }
     };
 
-    std::vector<TimeoutTuple> mTimerHeap;
+    size_t allocateSlot(apl_time_t startTime, apl_duration_t duration);
+    void schedule(size_t index);
+    void releaseSlot(size_t index);
+    void recycleSlot(size_t index);
+    void removeFromHeap(timeout_id id);
+
+    std::deque<TimerSlot> mSlots;       // A deque so that slot references survive new timers
+    std::vector<size_t> mFreeSlots;
+    std::unordered_map<timeout_id, size_t> mSlotById;
+    std::vector<HeapEntry> mTimerHeap;
+    size_t mAnimatorHead = NO_SLOT;
+    size_t mAnimatorTail = NO_SLOT;
+    size_t mAnimatorCursor = NO_SLOT;   // The next animator to visit in updateTime()
     apl_time_t mTime;
     timeout_id mNextId;
+    unsigned mAnimatorPass = 0;         // Incremented each time updateTime() runs the animators
     int mAnimatorCount;
     std::atomic<bool> mTerminated;
 };
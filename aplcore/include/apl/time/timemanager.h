@@ -27,6 +27,26 @@ namespace apl {
  */
 class TimeManager : public Timers {
 public:
+    using Ticker = std::function<bool()>;
+
+    /**
+     * Call a function repeatedly at a fixed interval.  The ticker is called once per interval until
+     * it returns false or the interval is cancelled with clearTimeout().
+     *
+     * The default implementation schedules a new timeout after each call, so the returned id can only
+     * cancel the interval before the first call.  Override this method to keep a single timer alive.
+     *
+     * @param ticker The function to call.  Return false to stop the interval.
+     * @param interval The time between calls.
+     * @return A unique ID for the interval.
+     */
+    virtual timeout_id setInterval(Ticker ticker, apl_duration_t interval) {
+        return setTimeout([this, ticker, interval]() {
+            if (ticker())
+                setInterval(ticker, interval);
+        }, interval);
+    }
+
     /**
      * @return The number of timers left to fire
      */
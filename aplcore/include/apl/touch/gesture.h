@@ -64,6 +64,14 @@ public:
      */
     virtual bool consume(const PointerEvent& event, apl_time_t timestamp);
 
+    /**
+     * Record a move that was coalesced into a later move event.  Gestures may use the sample for tracking, but
+     * should not change their state.
+     * @param event Pointer move event.
+     * @param timestamp Event timestamp.
+     */
+    void trackMove(const PointerEvent& event, apl_time_t timestamp) { if (mStarted) onTrackMove(event, timestamp); }
+
     /**
      * Reset internal gesture state.
      */
@@ -97,6 +105,13 @@ protected:
      */
     virtual bool onMove(const PointerEvent& event, apl_time_t timestamp) { return true; }
 
+    /**
+     * Handle a move that was coalesced into a later move event.
+     * @param event pointer event to track.
+     * @param timestamp pointer event timestamp.
+     */
+    virtual void onTrackMove(const PointerEvent& event, apl_time_t timestamp) {}
+
     /**
      * Handle time update
      * @param event pointer event to process (simulated in this case, so should be generally ignored)
@@ -37,6 +37,7 @@ public:
 
 protected:
     bool onMove(const PointerEvent& event, apl_time_t timestamp) override;
+    void onTrackMove(const PointerEvent& event, apl_time_t timestamp) override;
     bool onDown(const PointerEvent& event, apl_time_t timestamp) override;
     bool onUp(const PointerEvent& event, apl_time_t timestamp) override;
 
@@ -125,6 +125,31 @@ struct PointerEvent
     const PointerType pointerType;
 };
 
+/**
+ * A pointer event together with the time at which it was sampled.  Viewhosts with high-rate input devices use
+ * batches of samples to deliver every position reported by the device within a frame.
+ */
+struct PointerSample
+{
+    /**
+     * @param event The pointer event.
+     * @param timestamp The time the event was sampled, in the same time base as RootContext::updateTime.
+     */
+    PointerSample(const PointerEvent& event, apl_time_t timestamp)
+        : event(event),
+          timestamp(timestamp) {};
+
+    /**
+     * The pointer event
+     */
+    const PointerEvent event;
+
+    /**
+     * The time at which the event was sampled
+     */
+    const apl_time_t timestamp;
+};
+
 extern Bimap<PointerEventType, PropertyKey> sEventHandlers;
 
 } // namespace apl
@@ -18,6 +18,7 @@
 
 
 #include <map>
+#include <vector>
 
 #include "apl/touch/pointer.h"
 
@@ -78,6 +79,18 @@ public:
      */
     bool handlePointerEvent(const PointerEvent& pointerEvent, apl_time_t timestamp);
 
+    /**
+     * Handles a batch of PointerSamples in order.  A run of consecutive move samples for the same pointer is
+     * coalesced: the earlier samples of the run are only recorded for velocity tracking by the components that
+     * would receive them, and the final sample is handled by handlePointerEvent.  Other samples are handled by
+     * handlePointerEvent directly.
+     *
+     * @param samples The pointer samples to handle.
+     * @param currentTime The current time.  Later sample timestamps are clamped to this value.
+     * @return true if any of the handled events was consumed.
+     */
+    bool handlePointerEvents(const std::vector<PointerSample>& samples, apl_time_t currentTime);
+
     /**
      * Function to notify all interested parties about pointer related time updates.
      */
@@ -138,6 +151,14 @@ private:
                          const CoreComponentPtr& newTarget,
                          apl_time_t timestamp);
 
+    /**
+     * Record a move sample that is coalesced into a later move.  The sample is passed to the components that the
+     * move would be dispatched to, but no gesture state or event handlers are updated.
+     * @param pointerEvent The move event.
+     * @param timestamp The move timestamp.
+     */
+    void trackPointerMove(const PointerEvent& pointerEvent, apl_time_t timestamp);
+
 private:
     const RootContextData& mCore;
     std::shared_ptr<Pointer> mActivePointer;
@@ -50,6 +50,15 @@ public:
         return mItems.front().second;
     }
 
+    size_t size() const {
+        return mItems.size();
+    }
+
+    void clear() {
+        mItems.clear();
+        mAccess.clear();
+    }
+
 private:
     using itemPack = std::pair<K, V>;
     std::list<itemPack> mItems;
@@ -0,0 +1,82 @@
+/**
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#ifndef _APL_WORKER_POOL_H
+#define _APL_WORKER_POOL_H
+
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "apl/utils/noncopyable.h"
+
+namespace apl {
+
+/**
+ * A fixed set of threads that run batches of indexed tasks.  The threads are started by the
+ * constructor and joined by the destructor; between batches they sleep.
+ *
+ * Tasks are assigned statically: with N worker threads, task i runs on the calling thread when
+ * i % (N + 1) == 0 and on worker (i % (N + 1)) - 1 otherwise.  This keeps the assignment
+ * deterministic and guarantees that a batch with more than one task uses more than one thread.
+ */
+class WorkerPool : public NonCopyable {
+public:
+    using Task = std::function<void(size_t index)>;
+
+    /**
+     * Start the worker threads.
+     * @param threads Number of worker threads, not counting the calling thread.
+     */
+    explicit WorkerPool(size_t threads);
+
+    /**
+     * Stop and join the worker threads.
+     */
+    ~WorkerPool();
+
+    /**
+     * @return The number of worker threads, not counting the calling thread.
+     */
+    size_t size() const { return mThreads.size(); }
+
+    /**
+     * Run task(0) through task(count - 1) and return when all of them have finished.  The
+     * calling thread takes its share of the tasks.  This method is not re-entrant.
+     * @param count Number of tasks.
+     * @param task The task to run.
+     */
+    void run(size_t count, const Task& task);
+
+private:
+    void work(size_t worker);
+
+    const size_t mStride;   // Worker threads plus the calling thread
+    std::vector<std::thread> mThreads;
+    std::mutex mMutex;
+    std::condition_variable mStart;
+    std::condition_variable mDone;
+    const Task *mTask = nullptr;
+    size_t mCount = 0;
+    size_t mBatch = 0;      // Incremented for every batch; wakes the workers
+    size_t mRunning = 0;    // Workers that have not finished the current batch
+    bool mStop = false;
+};
+
+} // namespace apl
+
+#endif // _APL_WORKER_POOL_H
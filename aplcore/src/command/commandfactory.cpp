@@ -38,6 +38,7 @@ CommandFactory::instance()
 void
 CommandFactory::reset()
 {
+    mGeneration++;
     mCommandMap.clear();
     for (auto it = sCommandNameBimap.beginBtoA() ; it != sCommandNameBimap.endBtoA() ; ++it) {
         auto fptr = sCommandCreatorMap.find(it->second);
@@ -50,6 +51,7 @@ CommandFactory&
 CommandFactory::set(const char *name, CommandFunc func)
 {
     mCommandMap[name] = func;   // Allow over-writing
+    mGeneration++;
     return *this;
 }
 
@@ -138,6 +140,9 @@ CommandFactory::inflate(const ContextPtr& context,
     if (!command.isMap())
         return nullptr;
 
+    if (command.isJson())
+        return inflateTemplate(context, command.getJson(), properties, base, parentSequencer);
+
     auto type = propertyAsString(*context, command, "type");
     if (type.empty()) {
         CONSOLE_CTP(context) << "No type defined for command";
@@ -157,15 +162,90 @@ CommandFactory::inflate(const ContextPtr& context,
     if (method != mCommandMap.end())
         return method->second(context, std::move(props), base, parentSequencer);
 
+    return create(context, type, std::move(props), base, parentSequencer);
+}
+
+/**
+ * Expand a JSON command definition using the compiled template for that definition.  The template
+ * is cached in the document, so repeated execution of the same definition does not need to re-read
+ * the static properties or look up the standard command type again.
+ * @param context The context in which the command should be expanded.
+ * @param command The command definition.  Should be a map.
+ * @param properties Properties passed in from outside.
+ * @param base The base component in which the command was defined.
+ * @param parentSequencer The sequencer of the parent command.
+ * @return The inflated command or nullptr if it is invalid (or has a false "when' clause)
+ */
+CommandPtr
+CommandFactory::inflateTemplate(const ContextPtr& context,
+                                const rapidjson::Value& command,
+                                const Properties& properties,
+                                const CoreComponentPtr& base,
+                                const std::string& parentSequencer)
+{
+    auto commandTemplate = context->commandTemplates().get(command);
+
+    auto type = commandTemplate->type(*context, command);
+    if (type.empty()) {
+        CONSOLE_CTP(context) << "No type defined for command";
+        return nullptr;
+    }
+
+    if (!commandTemplate->when(*context, command))
+        return nullptr;
+
+    auto props = commandTemplate->properties(command, properties);
+
+    // Standard command types are resolved once per template
+    if (commandTemplate->hasStaticType()) {
+        if (!commandTemplate->hasCommandFunc(mGeneration)) {
+            auto method = mCommandMap.find(type);
+            commandTemplate->setCommandFunc(method != mCommandMap.end() ? method->second : nullptr, mGeneration);
+        }
+
+        const auto& func = commandTemplate->commandFunc();
+        if (func) {
+            auto result = func(context, std::move(props), base, parentSequencer);
+            auto coreCommand = std::dynamic_pointer_cast<CoreCommand>(result);
+            if (coreCommand)
+                coreCommand->setTemplate(commandTemplate);
+            return result;
+        }
+    }
+    else {
+        auto method = mCommandMap.find(type);
+        if (method != mCommandMap.end())
+            return method->second(context, std::move(props), base, parentSequencer);
+    }
+
+    return create(context, type, std::move(props), base, parentSequencer);
+}
+
+/**
+ * Create a command that is not a standard command type: either an extension command or a command macro.
+ * @param context The context in which the command should be expanded.
+ * @param type The command type.
+ * @param properties The command properties.
+ * @param base The base component in which the command was defined.
+ * @param parentSequencer The sequencer of the parent command.
+ * @return The inflated command or nullptr if it is invalid.
+ */
+CommandPtr
+CommandFactory::create(const ContextPtr& context,
+                       const std::string& type,
+                       Properties&& properties,
+                       const CoreComponentPtr& base,
+                       const std::string& parentSequencer)
+{
     // Check to see if it is an extension command
     auto extensionCommand = context->extensionManager().findCommandDefinition(type);
     if (extensionCommand != nullptr)
-        return ExtensionEventCommand::create(*extensionCommand, context, std::move(props), base, parentSequencer);
+        return ExtensionEventCommand::create(*extensionCommand, context, std::move(properties), base, parentSequencer);
 
     // Look up a command macro.
     const auto& resource = context->getCommand(type);
     if (!resource.empty())
-        return expandMacro(context, props, resource.json(), base, parentSequencer);
+        return expandMacro(context, properties, resource.json(), base, parentSequencer);
 
     CONSOLE_CTP(context) << "Unable to find command '" << type << "'";
     return nullptr;
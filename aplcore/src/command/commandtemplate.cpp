@@ -0,0 +1,189 @@
+/**
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#include <cstring>
+
+#include "apl/command/commandtemplate.h"
+#include "apl/engine/evaluate.h"
+
+namespace apl {
+
+/**
+ * A value is static if evaluating it in any context returns the value unchanged.  Strings may hold
+ * data-binding expressions or resource references.
+ */
+static bool
+isStatic(const Object& value)
+{
+    if (!value.isString())
+        return true;
+
+    const auto& s = value.getString();
+    return s.find("${") == std::string::npos && (s.empty() || s[0] != '@');
+}
+
+/**
+ * Compare a scalar JSON value against the Object it was converted to.
+ */
+static bool
+sameScalar(const rapidjson::Value& json, const Object& value)
+{
+    switch (json.GetType()) {
+        case rapidjson::kNullType:
+            return value.isNull();
+        case rapidjson::kFalseType:
+        case rapidjson::kTrueType:
+            return value.isBoolean() && value.getBoolean() == json.GetBool();
+        case rapidjson::kNumberType:
+            return value.isNumber() && value.getDouble() == json.GetDouble();
+        case rapidjson::kStringType:
+            return value.isString() && value.getString().size() == json.GetStringLength() &&
+                   std::memcmp(value.getString().data(), json.GetString(), json.GetStringLength()) == 0;
+        default:
+            return false;
+    }
+}
+
+CommandTemplate::CommandTemplate(const rapidjson::Value& json)
+{
+    assert(json.IsObject());
+
+    for (const auto& m : json.GetObject()) {
+        auto index = mMembers.size();
+        std::string name = m.name.GetString();
+        bool nested = m.value.IsObject() || m.value.IsArray();
+        Object value = nested ? Object::NULL_OBJECT() : Object(m.value);
+
+        if (name == "type") {
+            if (nested || !isStatic(value))
+                mTypeIndex = static_cast<int>(index);
+            else
+                mType = value.asString();
+        }
+        else if (name == "when") {
+            if (nested || !isStatic(value))
+                mWhenIndex = static_cast<int>(index);
+            else
+                mWhen = value.asBoolean();
+        }
+        else if (nested) {
+            mNested.emplace_back(index);
+        }
+        else {
+            mProperties.emplace(name, value);
+        }
+
+        mMembers.emplace_back(Member{std::move(name), std::move(value), nested});
+    }
+}
+
+bool
+CommandTemplate::matches(const rapidjson::Value& json) const
+{
+    if (!json.IsObject() || json.MemberCount() != mMembers.size())
+        return false;
+
+    auto it = mMembers.begin();
+    for (const auto& m : json.GetObject()) {
+        if (it->name.size() != m.name.GetStringLength() ||
+            std::memcmp(it->name.data(), m.name.GetString(), it->name.size()) != 0)
+            return false;
+
+        if (it->nested ? !(m.value.IsObject() || m.value.IsArray()) : !sameScalar(m.value, it->value))
+            return false;
+
+        it++;
+    }
+
+    return true;
+}
+
+std::string
+CommandTemplate::type(const Context& context, const rapidjson::Value& json) const
+{
+    if (mTypeIndex < 0)
+        return mType;
+
+    return evaluate(context, Object(json.MemberBegin()[mTypeIndex].value)).asString();
+}
+
+bool
+CommandTemplate::when(const Context& context, const rapidjson::Value& json) const
+{
+    if (mWhenIndex < 0)
+        return mWhen;
+
+    return evaluate(context, Object(json.MemberBegin()[mWhenIndex].value)).asBoolean();
+}
+
+Properties
+CommandTemplate::properties(const rapidjson::Value& json, const Properties& properties) const
+{
+    // Copies of the static properties share storage until a nested value is added
+    Properties result = properties;
+    result.emplace(mProperties);
+
+    for (const auto& index : mNested) {
+        const auto& m = json.MemberBegin()[index];
+        result.emplace(mMembers.at(index).name, Object(m.value));
+    }
+
+    return result;
+}
+
+bool
+CommandTemplate::getConverted(int key, const Object& value, Object& result) const
+{
+    auto it = mConverted.find(key);
+    if (it == mConverted.end() || it->second.first != value)
+        return false;
+
+    result = it->second.second;
+    return true;
+}
+
+void
+CommandTemplate::setConverted(int key, const std::string& name, const Object& value, const Object& converted)
+{
+    if (!hasStaticType())
+        return;
+
+    // Data-bound values may convert differently in another context
+    auto it = mProperties.find(name);
+    if (it == mProperties.end() || it->second != value || !isStatic(value))
+        return;
+
+    mConverted[key] = {value, converted};
+}
+
+CommandTemplatePtr
+CommandTemplateCache::get(const rapidjson::Value& json)
+{
+    if (mTemplates.has(&json)) {
+        auto& result = mTemplates.get(&json);
+        if (result->matches(json))
+            return result;
+
+        // The JSON at this address has been replaced
+        result = std::make_shared<CommandTemplate>(json);
+        return result;
+    }
+
+    auto result = std::make_shared<CommandTemplate>(json);
+    mTemplates.put(&json, result);
+    return result;
+}
+
+} // namespace apl
@@ -52,21 +52,45 @@ const static bool DEBUG_COMMAND_VALUES = false;
 
 /*****************************************************************/
 
+/**
+ * @param def The command property definition
+ * @return True if converting a static value of this property gives the same result in any context.
+ */
+static bool
+isContextFree(const CommandPropDef& def)
+{
+    if ((def.flags & kPropEvaluated) != 0)
+        return false;
+
+    if (def.map)
+        return true;
+
+    auto func = def.func.target<Object(*)(const Context&, const Object&)>();
+    return func && (*func == asString || *func == asBoolean || *func == asInteger ||
+                    *func == asNonNegativeInteger);
+}
+
 /**
  * Calculate a single property based on a command property definition
  * @param def The command property definition
  * @param context The evaluation context
  * @param properties All properties assigned to this command
+ * @param commandTemplate The template the command was built from.  May be null.
  * @return A pair consisting of true/false if the property was well-formed followed by the value of the property.
  */
 static std::pair<bool, Object>
 calculate(const CommandPropDef& def,
           const ContextPtr& context,
-          const Properties& properties)
+          const Properties& properties,
+          CommandTemplate *commandTemplate)
 {
     auto p = properties.find(def.names);
 
     if (p != properties.end()) {
+        Object result;
+        if (commandTemplate && commandTemplate->getConverted(def.key, p->second, result))
+            return {true, result};
+
         Object tmp = (def.flags & kPropEvaluated) != 0 ?
             evaluateRecursive(*context, p->second) :
             evaluate(*context, p->second);
@@ -75,10 +99,15 @@ calculate(const CommandPropDef& def,
             int value = def.map->get(tmp.asString(), -1);
             if (value == -1)
                 return {false, def.defvalue};
-            return {true, value};
+            result = value;
         } else {
-            return {true, def.func(*context, tmp)};
+            result = def.func(*context, tmp);
         }
+
+        if (commandTemplate && isContextFree(def))
+            commandTemplate->setConverted(def.key, p->first, p->second, result);
+
+        return {true, result};
     }
 
     return {true, def.defvalue};
@@ -213,7 +242,7 @@ CoreCommand::calculateProperties()
     // Evaluate all of the properties, including componentId (we store it for the debugger)
     for (const auto& it : propDefSet()) {
         if (it.second.key != kCommandPropertyComponentId) {
-            auto result = calculate(it.second, context, mProperties);
+            auto result = calculate(it.second, context, mProperties, mTemplate.get());
 
             // Enumerated properties must be valid
             if (!result.first) {
@@ -159,6 +159,20 @@ ActionableComponent::processGestures(const PointerEvent& event, apl_time_t times
     return false;
 }
 
+void
+ActionableComponent::trackPointerMove(const PointerEvent& event, apl_time_t timestamp) {
+    if (mGesturesDisabled || mState.get(kStateDisabled)) return;
+
+    if (mActiveGesture) {
+        if (mActiveGesture->isTriggered())
+            mActiveGesture->trackMove(event, timestamp);
+        return;
+    }
+
+    for (auto& gesture : mGestureHandlers)
+        gesture->trackMove(event, timestamp);
+}
+
 void
 ActionableComponent::invokeStandardAccessibilityAction(const std::string& name)
 {
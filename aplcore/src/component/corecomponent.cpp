@@ -30,6 +30,7 @@
 #include "apl/engine/hovermanager.h"
 #include "apl/engine/keyboardmanager.h"
 #include "apl/engine/layoutmanager.h"
+#include "apl/engine/tickhandler.h"
 #include "apl/focus/focusmanager.h"
 #include "apl/livedata/layoutrebuilder.h"
 #include "apl/livedata/livearray.h"
@@ -112,23 +113,23 @@ CoreComponent::CoreComponent(const ContextPtr& context,
 }
 
 void
-CoreComponent::scheduleTickHandler(const Object& handler, double delay) {
+CoreComponent::scheduleTickHandler(const Object& handler) {
     auto weak_ptr = std::weak_ptr<CoreComponent>(std::static_pointer_cast<CoreComponent>(shared_from_this()));
-    // Lambda capture takes care of handler here as it's a copy.
-    mContext->getRootConfig().getTimeManager()->setTimeout([weak_ptr, handler, delay]() {
+    TickHandler tick(*mContext, handler);
+
+    // The event context carries the component state, so it is rebuilt on every tick
+    mContext->getRootConfig().getTimeManager()->setInterval([weak_ptr, tick]() {
         auto self = weak_ptr.lock();
         if (!self)
-            return;
+            return false;
 
         auto ctx = self->createEventContext("Tick");
-        if (propertyAsBoolean(*ctx, handler, "when", true)) {
-            auto commands = Object(arrayifyProperty(*ctx, handler, "commands"));
-            if (!commands.empty())
-                ctx->sequencer().executeCommands(commands, ctx, self, true);
-        }
+        auto commands = tick.commands(*ctx);
+        if (!commands.empty())
+            ctx->sequencer().executeCommands(commands, ctx, self, true);
 
-        self->scheduleTickHandler(handler, delay);
-    }, delay);
+        return true;
+    }, tick.delay());
 }
 
 void
@@ -137,11 +138,8 @@ CoreComponent::processTickHandlers() {
     if (tickHandlers.empty() || !tickHandlers.isArray())
         return;
 
-    for (const auto& handler : tickHandlers.getArray()) {
-        auto delay = std::max(propertyAsDouble(*mContext, handler, "minimumDelay", 1000),
-                mContext->getRootConfig().getTickHandlerUpdateLimit());
-        scheduleTickHandler(handler, delay);
-    }
+    for (const auto& handler : tickHandlers.getArray())
+        scheduleTickHandler(handler);
 }
 
 void
@@ -438,21 +436,7 @@ CoreComponent::ensureDisplayedChildren()
         // only visible children
         if (child->isDisplayable()) {
             // compare child rect, transformed as needed, against the viewport
-            auto childBounds = child->getCalculated(kPropertyBounds).getRect();
-            auto transform = child->getCalculated(kPropertyTransform).getTransform2D();
-            // The axis aligned bounding box is an approximation for checking bounds intersection.
-            // The AABB test eliminates children that are guaranteed NOT to intersect. It does not
-            // prove the parent and child do intersect.
-            // TODO a complete solution applies the "separating axis theorem". The parent AABB is
-            // TODO transformed into the child space and tested for intersection. If a separating axis cannot be
-            // TODO identified using both tests, the parent and child intersect.
-
-            // Note that the transform is applied assuming the top-left corner of the child is at (0,0)
-            Point childBoundsTopLeft = childBounds.getTopLeft();
-            childBounds = transform.calculateAxisAlignedBoundingBox(Rect{0, 0, childBounds.getWidth(), childBounds.getHeight()});
-            childBounds.offset(childBoundsTopLeft);
-
-            if (!viewportRect.intersect(childBounds).isEmpty()) {
+            if (!viewportRect.intersect(displayBoundingBox(*child)).isEmpty()) {
                 if (child->getCalculated(kPropertyPosition) == kPositionSticky) {
                     sticky.emplace_back(child);
                 } else {
@@ -468,6 +452,25 @@ CoreComponent::ensureDisplayedChildren()
     mDisplayedChildrenStale = false;
 }
 
+Rect
+CoreComponent::displayBoundingBox(const CoreComponent& child)
+{
+    auto childBounds = child.getCalculated(kPropertyBounds).getRect();
+    auto transform = child.getCalculated(kPropertyTransform).getTransform2D();
+    // The axis aligned bounding box is an approximation for checking bounds intersection.
+    // The AABB test eliminates children that are guaranteed NOT to intersect. It does not
+    // prove the parent and child do intersect.
+    // TODO a complete solution applies the "separating axis theorem". The parent AABB is
+    // TODO transformed into the child space and tested for intersection. If a separating axis cannot be
+    // TODO identified using both tests, the parent and child intersect.
+
+    // Note that the transform is applied assuming the top-left corner of the child is at (0,0)
+    Point childBoundsTopLeft = childBounds.getTopLeft();
+    childBounds = transform.calculateAxisAlignedBoundingBox(Rect{0, 0, childBounds.getWidth(), childBounds.getHeight()});
+    childBounds.offset(childBoundsTopLeft);
+    return childBounds;
+}
+
 bool
 CoreComponent::insertChild(const ComponentPtr& child, size_t index)
 {
@@ -808,9 +811,9 @@ CoreComponent::handlePropertyChange(const ComponentPropDef& def, const Object& v
                 verticalScrollable->getStickyTree()->handleChildStickyUnset();
         }
 
-        // display change, or opacity change to/from 0, makes parent display stale
+        // display or position change, or opacity change to/from 0, makes parent display stale
         if (mParent
-            && (def.key == kPropertyDisplay
+            && (def.key == kPropertyDisplay || def.key == kPropertyPosition
              ||(def.key == kPropertyOpacity && ((value.asNumber() == 0) != (previous.asNumber() == 0))))) {
 
                 mParent->markDisplayedChildrenStale(true);
@@ -1353,6 +1356,9 @@ CoreComponent::processLayoutChanges(bool useDirtyFlag, bool first)
     if (DEBUG_BOUNDS) YGNodePrint(mYGNodeRef, YGPrintOptions::YGPrintOptionsLayout);
     APL_TRACE_BLOCK("CoreComponent:processLayoutChanges");
 
+    // Clear the flag first; a nested layout pass during this call may set it again
+    YGNodeSetHasNewLayout(mYGNodeRef, false);
+
     float left = YGNodeLayoutGetLeft(mYGNodeRef);
     float top = YGNodeLayoutGetTop(mYGNodeRef);
     float width = YGNodeLayoutGetWidth(mYGNodeRef);
@@ -1378,6 +1384,7 @@ CoreComponent::processLayoutChanges(bool useDirtyFlag, bool first)
 
     Rect rect(left, top, width, height);
     changed |= rect != mCalculated.get(kPropertyBounds).getRect();
+    bool boundsChanged = changed;
 
     if (changed) {
         mCalculated.set(kPropertyBounds, std::move(rect));
@@ -1406,6 +1413,7 @@ CoreComponent::processLayoutChanges(bool useDirtyFlag, bool first)
                      width - (borderLeft + paddingLeft + borderRight + paddingRight),
                      height - (borderTop + paddingTop + borderBottom + paddingBottom));
     changed = inner != mCalculated.get(kPropertyInnerBounds).getRect();
+    mContext->layoutManager().recordLayoutChange(boundsChanged || changed);
 
     if (changed) {
         mCalculated.set(kPropertyInnerBounds, std::move(inner));
@@ -1423,11 +1431,45 @@ CoreComponent::processLayoutChanges(bool useDirtyFlag, bool first)
     // Break out early if possible - there are no need to propagate to children
     if (shouldNotPropagateLayoutChanges()) return;
 
-    // Inform all children that they should re-check their bounds. No need to do that for not attached ones.
-    // Note that children of a Pager are not attached, and hence they will not be processed.
-    for (auto& child : mChildren)
-        if (child->isAttached())
+    processChildLayoutChanges(useDirtyFlag, first);
+}
+
+void
+CoreComponent::processChildLayoutChanges(bool useDirtyFlag, bool first)
+{
+    // Inform the children that they should re-check their bounds.  No need to do that for not attached
+    // ones.  Note that children of a Pager are not attached, and hence they will not be processed.
+    //
+    // Yoga flags the nodes that it laid out; the others normally keep their bounds.  However, pixel
+    // rounding is applied to the whole tree from absolute positions, so a cached node can still end up
+    // with different bounds.  The cheap comparison in layoutChangedSinceProcessed() catches those.  A
+    // child that is unchanged is not processed, but its own children are still checked.
+    for (auto& child : mChildren) {
+        if (!child->isAttached())
+            continue;
+
+        if (first || YGNodeGetHasNewLayout(child->mYGNodeRef) || child->layoutChangedSinceProcessed())
             child->processLayoutChanges(useDirtyFlag, first);
+        else if (!child->shouldNotPropagateLayoutChanges())
+            child->processChildLayoutChanges(useDirtyFlag, first);
+    }
+}
+
+bool
+CoreComponent::layoutChangedSinceProcessed() const
+{
+    if (alwaysProcessLayoutChanges() || getCalculated(kPropertyPosition) == kPositionSticky)
+        return true;
+
+    auto direction = YGNodeLayoutGetDirection(mYGNodeRef) == YGDirectionRTL ? kLayoutDirectionRTL : kLayoutDirectionLTR;
+    if (direction != mCalculated.get(kPropertyLayoutDirection).asInt())
+        return true;
+
+    auto bounds = mCalculated.get(kPropertyBounds).getRect();
+    return bounds.getX() != YGNodeLayoutGetLeft(mYGNodeRef) ||
+           bounds.getY() != YGNodeLayoutGetTop(mYGNodeRef) ||
+           bounds.getWidth() != YGNodeLayoutGetWidth(mYGNodeRef) ||
+           bounds.getHeight() != YGNodeLayoutGetHeight(mYGNodeRef);
 }
 
 
@@ -2132,6 +2174,13 @@ CoreComponent::executeEventHandler(const std::string& event, const Object& comma
 YGSize
 CoreComponent::textMeasureInternal(float width, YGMeasureMode widthMode, float height, YGMeasureMode heightMode)
 {
+    auto& layoutManager = getContext()->layoutManager();
+
+    // Layout roots may be measured concurrently.  Tracing and logging are not thread-safe, so they
+    // are skipped on the worker threads, and the caches are guarded by the measurement lock.
+    if (layoutManager.isConcurrent())
+        return textMeasureConcurrent(width, widthMode, height, heightMode);
+
     APL_TRACE_BLOCK("CoreComponent:textMeasureInternal");
     auto componentHash = textMeasurementHash();
     LOG_IF(DEBUG_MEASUREMENT)
@@ -2158,9 +2207,35 @@ CoreComponent::textMeasureInternal(float width, YGMeasureMode widthMode, float h
     return size;
 }
 
+YGSize
+CoreComponent::textMeasureConcurrent(float width, YGMeasureMode widthMode, float height, YGMeasureMode heightMode)
+{
+    TextMeasureRequest tmr = {width, widthMode, height, heightMode, textMeasurementHash()};
+    auto& measuresCache = getContext()->cachedMeasures();
+    auto& layoutManager = getContext()->layoutManager();
+    {
+        auto lock = layoutManager.measurementLock();
+        if (measuresCache.has(tmr)) {
+            return measuresCache.get(tmr);
+        }
+    }
+
+    LayoutSize layoutSize = getContext()->measure()->measure(
+            this, width, toMeasureMode(widthMode), height, toMeasureMode(heightMode));
+    auto size = YGSize({layoutSize.width, layoutSize.height});
+    {
+        auto lock = layoutManager.measurementLock();
+        measuresCache.put(tmr, size);
+    }
+    return size;
+}
+
 float
 CoreComponent::textBaselineInternal(float width, float height)
 {
+    if (getContext()->layoutManager().isConcurrent())
+        return textBaselineConcurrent(width, height);
+
     APL_TRACE_BEGIN("CoreComponent:textBaselineInternal");
     TextMeasureRequest tmr = {
             width,
@@ -2181,6 +2256,33 @@ CoreComponent::textBaselineInternal(float width, float height)
     return size;
 }
 
+float
+CoreComponent::textBaselineConcurrent(float width, float height)
+{
+    TextMeasureRequest tmr = {
+            width,
+            YGMeasureMode::YGMeasureModeUndefined,
+            height,
+            YGMeasureMode::YGMeasureModeUndefined,
+            textMeasurementHash()
+    };
+    auto& baselineCache = getContext()->cachedBaselines();
+    auto& layoutManager = getContext()->layoutManager();
+    {
+        auto lock = layoutManager.measurementLock();
+        if (baselineCache.has(tmr)) {
+            return baselineCache.get(tmr);
+        }
+    }
+
+    auto size = getContext()->measure()->baseline(this, width, height);
+    {
+        auto lock = layoutManager.measurementLock();
+        baselineCache.put(tmr, size);
+    }
+    return size;
+}
+
 YGSize
 CoreComponent::textMeasureFunc( YGNodeRef node,
                  float width,
@@ -2384,6 +2486,10 @@ CoreComponent::ensureGlobalToLocalTransform() {
     // the mark will bubble up to this component during this phase.
     if (mParent) {
         mParent->ensureGlobalToLocalTransform();
+
+        // The parent scroll position is applied lazily, so scrolling does not have to mark every child stale
+        if (mParent->scrollPosition() != mGlobalToLocalScroll)
+            mGlobalToLocalIsStale = true;
     }
 
     if (!mGlobalToLocalIsStale) {
@@ -2405,6 +2511,7 @@ CoreComponent::ensureGlobalToLocalTransform() {
         // coordinate space of children, so we account for it in the child component
         // transformation.
         auto scrollPosition = mParent->scrollPosition();
+        mGlobalToLocalScroll = scrollPosition;
         newLocalTransform = newLocalTransform
                 * Transform2D::translate(scrollPosition)
                 * mParent->getGlobalToLocalTransform();
@@ -922,6 +922,11 @@ MultiChildScrollableComponent::processLayoutChangesInternal(bool useDirtyFlag, b
     float childCache = mContext->getRootConfig().getSequenceChildCache();
     float pageSize = horizontal ? sequenceBounds.getWidth() : sequenceBounds.getHeight();
 
+    // Past the frame deadline, only the children in view are laid out and the cache is filled in later
+    bool deferCache = !first && !delayed && mContext->layoutManager().pastDeadline();
+    if (deferCache)
+        childCache = 0;
+
     // Try to figure majority of layout as a bulk
     runLayoutHeuristics(anchorIdx, childCache, pageSize, useDirtyFlag, first);
     // Anchor bounds may have shifted
@@ -992,9 +997,10 @@ MultiChildScrollableComponent::processLayoutChangesInternal(bool useDirtyFlag, b
 
     ensureChildrenVisibilityUpdated();
 
-    if (first) {
+    if (first || deferCache) {
         // Avoid yoga initiated re-layout that may be caused by attaching components that were already laid-out
-        mContext->layoutManager().remove(getLayoutRoot());
+        if (first)
+            mContext->layoutManager().remove(getLayoutRoot());
 
         // Postpone to the next frame, if any
         if (mEnsuredChildren.upperBound() + 1 >= mChildren.size()) return;
@@ -1013,15 +1019,9 @@ MultiChildScrollableComponent::processLayoutChangesInternal(bool useDirtyFlag, b
 
 void
 MultiChildScrollableComponent::onScrollPositionUpdated() {
+    // Children pick up the new scroll position the next time their transforms are needed
     ScrollableComponent::onScrollPositionUpdated();
 
-    for (int i = mEnsuredChildren.lowerBound(); i <= mEnsuredChildren.upperBound(); i++) {
-        auto child = std::dynamic_pointer_cast<CoreComponent>(mChildren.at(i));
-        if (child != nullptr && child->isAttached()) {
-            child->markGlobalToLocalTransformStale();
-        }
-    }
-
     mChildrenVisibilityStale = true;
 
     // Force figuring out what is on screen.
@@ -13,6 +13,9 @@
  * permissions and limitations under the License.
  */
 
+#include <algorithm>
+#include <limits>
+
 #include "apl/action/scrollaction.h"
 #include "apl/component/componentpropdef.h"
 #include "apl/component/scrollablecomponent.h"
@@ -79,16 +82,29 @@ ScrollableComponent::setScrollPositionInternal(float value)
 
     // Only run the onScroll event handler once the component has been fully laid out.  This prevents the handler
     // from being run if the component was created with a scroll offset.
-    if (allowEventHandlers()) {
-        ContextPtr eventContext = createEventContext("Scroll");
-        mContext->sequencer().executeCommands(getCalculated(kPropertyOnScroll),
-                                              eventContext,
+    const auto& commands = getCalculated(kPropertyOnScroll);
+    if (allowEventHandlers() && !commands.empty()) {
+        mContext->sequencer().executeCommands(commands,
+                                              scrollEventContext(),
                                               shared_from_corecomponent(),
                                               true);
     }
     return true;
 }
 
+ContextPtr
+ScrollableComponent::scrollEventContext()
+{
+    // A context that no running command holds on to can be refreshed in place
+    if (mScrollEventContext && mScrollEventContext.use_count() == 1) {
+        mScrollEventContext->updateConstant("event", createEventProperties("Scroll", getValue()));
+        return mScrollEventContext;
+    }
+
+    mScrollEventContext = createEventContext("Scroll");
+    return mScrollEventContext;
+}
+
 void
 ScrollableComponent::setScrollPositionDirectly(float value)
 {
@@ -148,12 +164,103 @@ void
 ScrollableComponent::onScrollPositionUpdated()
 {
     setVisualContextDirty();
-    markDisplayedChildrenStale(true);
+    // Only the viewport moved; the cached display candidates are still valid
+    CoreComponent::markDisplayedChildrenStale(true);
     setDirty(kPropertyScrollPosition);
 
     mStickyTree->updateStickyOffsets();
 }
 
+void
+ScrollableComponent::markDisplayedChildrenStale(bool useDirtyFlag)
+{
+    CoreComponent::markDisplayedChildrenStale(useDirtyFlag);
+    mDisplayCandidatesStale = true;
+}
+
+void
+ScrollableComponent::updateDisplayCandidates()
+{
+    auto horizontal = isHorizontal();
+
+    mDisplayCandidates.clear();
+    mDisplayCandidateReach.clear();
+    mStickyCandidates.clear();
+
+    for (size_t index = 0; index < mChildren.size(); index++) {
+        const auto& child = mChildren.at(index);
+        if (!child->isDisplayable())
+            continue;
+
+        if (child->getCalculated(kPropertyPosition) == kPositionSticky) {
+            mStickyCandidates.emplace_back(child);
+        } else {
+            auto bounds = displayBoundingBox(*child);
+            mDisplayCandidates.emplace_back(DisplayCandidate{horizontal ? bounds.getLeft() : bounds.getTop(),
+                                                             bounds, index});
+        }
+    }
+
+    std::stable_sort(mDisplayCandidates.begin(), mDisplayCandidates.end(),
+                     [](const DisplayCandidate& a, const DisplayCandidate& b) { return a.leading < b.leading; });
+
+    float reach = -std::numeric_limits<float>::infinity();
+    mDisplayCandidateReach.reserve(mDisplayCandidates.size());
+    for (const auto& m : mDisplayCandidates) {
+        reach = std::max(reach, horizontal ? m.bounds.getRight() : m.bounds.getBottom());
+        mDisplayCandidateReach.emplace_back(reach);
+    }
+
+    mDisplayCandidatesHorizontal = horizontal;
+    mDisplayCandidatesStale = false;
+}
+
+/**
+ * Scrolling only moves the viewport, so the bounding boxes of the children are cached and sorted along
+ * the scroll axis.  The children that may intersect the viewport are found with two binary searches:
+ * the running maximum of the trailing edges skips children that end before the viewport starts and the
+ * leading edges stop the scan where children start after the viewport ends.
+ */
+void
+ScrollableComponent::ensureDisplayedChildren()
+{
+    if (!mDisplayedChildrenStale)
+        return;
+
+    if (mDisplayCandidatesStale || mDisplayCandidatesHorizontal != isHorizontal())
+        updateDisplayCandidates();
+
+    mDisplayedChildren.clear();
+
+    Rect bounds = getCalculated(kPropertyBounds).getRect();
+    Rect viewportRect = Rect(0, 0, bounds.getWidth(), bounds.getHeight());
+    viewportRect.offset(scrollPosition());
+
+    auto viewStart = mDisplayCandidatesHorizontal ? viewportRect.getLeft() : viewportRect.getTop();
+    auto viewEnd = mDisplayCandidatesHorizontal ? viewportRect.getRight() : viewportRect.getBottom();
+
+    auto it = std::upper_bound(mDisplayCandidateReach.begin(), mDisplayCandidateReach.end(), viewStart);
+    std::vector<size_t> visible;
+    for (auto i = static_cast<size_t>(std::distance(mDisplayCandidateReach.begin(), it));
+         i < mDisplayCandidates.size() && mDisplayCandidates.at(i).leading < viewEnd; i++) {
+        const auto& candidate = mDisplayCandidates.at(i);
+        if (!viewportRect.intersect(candidate.bounds).isEmpty())
+            visible.emplace_back(candidate.index);
+    }
+
+    // Children are drawn in order, with the sticky children at the end
+    std::sort(visible.begin(), visible.end());
+    for (auto index : visible)
+        mDisplayedChildren.emplace_back(mChildren.at(index));
+
+    // Sticky children move with the scroll position, so they are tested every time
+    for (const auto& child : mStickyCandidates)
+        if (!viewportRect.intersect(displayBoundingBox(*child)).isEmpty())
+            mDisplayedChildren.emplace_back(child);
+
+    mDisplayedChildrenStale = false;
+}
+
 bool
 ScrollableComponent::canConsumeFocusDirectionEvent(FocusDirection direction, bool fromInside)
 {
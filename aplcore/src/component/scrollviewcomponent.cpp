@@ -100,15 +100,4 @@ ScrollViewComponent::allowBackwards() const {
     return (currentPosition > 0);
 }
 
-void
-ScrollViewComponent::onScrollPositionUpdated() {
-    ScrollableComponent::onScrollPositionUpdated();
-    markDisplayedChildrenStale(true);
-
-    if (getChildCount() > 0) {
-        auto child = getCoreChildAt(0);
-        child->markGlobalToLocalTransformStale();
-    }
-}
-
 } // namespace apl
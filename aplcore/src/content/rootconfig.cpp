@@ -149,6 +149,9 @@ RootConfig::propDefSet() const
             {RootProperty::kSendEventAdditionalFlags,                    Object::EMPTY_MAP(),                           asAny},
             {RootProperty::kTextMeasurementCacheLimit,                   500,                                           asInteger},
             {RootProperty::kInitialDisplayState,                         DEFAULT_DISPLAY_STATE,                         sDisplayStateMap},
+            {RootProperty::kLayoutWorkerThreads,                         0,                                             asNonNegativeInteger},
+            {RootProperty::kIncrementalReinflation,                      false,                                         asBoolean},
+            {RootProperty::kMaxMediaRequestsInFlight,                    0,                                             asNonNegativeInteger},
         });
     return sRootProperties;
 }
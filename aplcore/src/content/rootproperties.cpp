@@ -68,6 +68,9 @@ Bimap<int, std::string> sRootPropertyBimap = {
         { RootProperty::kUEScrollerMaxDuration,                       "scroller.ue.maxDuration" },
         { RootProperty::kUEScrollerDeceleration,                      "scroller.ue.deceleration" },
         { RootProperty::kSendEventAdditionalFlags,                    "sendEvent.flags" },
+        { RootProperty::kLayoutWorkerThreads,                         "layout.workerThreads" },
+        { RootProperty::kIncrementalReinflation,                      "reinflation.incremental" },
+        { RootProperty::kMaxMediaRequestsInFlight,                    "media.maxRequestsInFlight" },
 };
 
 }
@@ -75,6 +75,7 @@ ByteCodeAssembler::parse(const Context& context, const std::string& value)
         datagrammar::ByteCodeAssembler assembler(context);
 
         pegtl::parse<datagrammar::grammar, datagrammar::action, PEGTL_ERROR_CTRL>(in, assembler);
+        assembler.recordEnvironmentReads();
         return assembler.retrieve();
     }
     catch (const pegtl::parse_error& e) {
@@ -103,6 +104,31 @@ ByteCodeAssembler::retrieve() const
     return mCode.byteCode;
 }
 
+/**
+ * Tell the context which environment values this expression read.  A load of "viewport" followed
+ * immediately by an attribute access is recorded as that single field ("viewport.width"); anything
+ * else (for example, passing the viewport to a function) is recorded as a read of the entire object.
+ * Loads are only collected when the context tracks environment reads.
+ */
+void
+ByteCodeAssembler::recordEnvironmentReads() const
+{
+    if (mEnvironmentLoads.empty())
+        return;
+
+    static const std::string EMPTY;
+    unsigned flags = 0;
+    for (const auto& m : mEnvironmentLoads) {
+        auto next = m.first + 1;
+        if (next < mInstructionRef->size() && mInstructionRef->at(next).type == BC_OPCODE_ATTRIBUTE_ACCESS)
+            flags |= environmentReadFlags(m.second, mDataRef->at(mInstructionRef->at(next).value).asString());
+        else
+            flags |= environmentReadFlags(m.second, EMPTY);
+    }
+
+    mContext->recordEnvironmentRead(flags);
+}
+
 void
 ByteCodeAssembler::loadOperand(const apl::Object& value)
 {
@@ -137,6 +163,9 @@ ByteCodeAssembler::loadGlobal(const std::string& name)
     auto len = asBCI(mDataRef->size());
     // Immutable globals can be replaced by a constant value
     if (!cr.object().isMutable()) {
+        if (mContext->trackEnvironmentReads() && (name == "viewport" || name == "environment") &&
+            cr.context() == mContext->top())
+            mEnvironmentLoads.emplace_back(mInstructionRef->size(), name);
         mDataRef->emplace_back(cr.object().value());
         mInstructionRef->emplace_back(ByteCodeInstruction{BC_OPCODE_LOAD_DATA, len});
         return;
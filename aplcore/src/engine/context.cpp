@@ -142,10 +142,44 @@ Context::Context(const Metrics& metrics, const RootConfig& config, const std::st
     init(metrics, mCore);
 }
 
+unsigned
+environmentReadFlags(const std::string& name, const std::string& field)
+{
+    static const std::map<std::string, unsigned> sViewportFlags = {
+        {"width",       kEnvironmentReadViewportWidth},
+        {"height",      kEnvironmentReadViewportHeight},
+        {"dpi",         kEnvironmentReadViewportDpi},
+        {"pixelWidth",  kEnvironmentReadViewportPixelWidth},
+        {"pixelHeight", kEnvironmentReadViewportPixelHeight},
+    };
+
+    static const std::map<std::string, unsigned> sEnvironmentFlags = {
+        {"fontScale",    kEnvironmentReadFontScale},
+        {"screenMode",   kEnvironmentReadScreenMode},
+        {"screenReader", kEnvironmentReadScreenReader},
+        {"reason",       kEnvironmentReadReason},
+    };
+
+    bool viewport = name == "viewport";
+    if (!viewport && name != "environment")
+        return 0;
+
+    if (field.empty())
+        return viewport ? kEnvironmentReadViewport : kEnvironmentReadEnvironment;
+
+    const auto& flags = viewport ? sViewportFlags : sEnvironmentFlags;
+    auto it = flags.find(field);
+    if (it != flags.end())
+        return it->second;
+
+    return viewport ? kEnvironmentReadViewportOther : kEnvironmentReadEnvironmentOther;
+}
+
 double
 Context::vwToDp(double vw) const
 {
     assert(mCore);
+    mCore->recordEnvironmentRead(kEnvironmentReadViewportWidth);
     return mCore->getWidth() * vw / 100;
 }
 
@@ -153,6 +187,7 @@ double
 Context::vhToDp(double vh) const
 {
     assert(mCore);
+    mCore->recordEnvironmentRead(kEnvironmentReadViewportHeight);
     return mCore->getHeight() * vh / 100;
 }
 
@@ -160,9 +195,24 @@ double
 Context::pxToDp(double px) const
 {
     assert(mCore);
+    mCore->recordEnvironmentRead(kEnvironmentReadViewportDpi);
     return mCore->getPxToDp() * px;
 }
 
+bool
+Context::trackEnvironmentReads() const
+{
+    assert(mCore);
+    return mCore->trackEnvironmentReads();
+}
+
+void
+Context::recordEnvironmentRead(unsigned flags) const
+{
+    assert(mCore);
+    mCore->recordEnvironmentRead(flags);
+}
+
 double
 Context::width() const
 {
@@ -285,7 +335,7 @@ Context::findComponentById(const std::string& id) const
 void
 Context::pushEvent(Event&& event) {
     assert(mCore);
-    mCore->events.push(event);
+    mCore->events.push(std::move(event));
 }
 
 #ifdef ALEXAEXTENSIONS
@@ -293,7 +343,7 @@ void
 Context::pushExtensionEvent(Event&& event)
 {
     assert(mCore);
-    mCore->extesnionEvents.push(event);
+    mCore->extesnionEvents.push(std::move(event));
 }
 #endif
 
@@ -414,6 +464,18 @@ Context::cachedBaselines()
     return mCore->cachedBaselines();
 }
 
+CommandTemplateCache&
+Context::commandTemplates()
+{
+    return mCore->commandTemplates();
+}
+
+LruCache<std::string, GraphicPathGeometryPtr>&
+Context::pathGeometries()
+{
+    return mCore->pathGeometries();
+}
+
 WeakPtrSet<CoreComponent>&
 Context::pendingOnMounts()
 {
@@ -27,6 +27,7 @@ Bimap<int, std::string> sEventTypeBimap = {
     {kEventTypeExtension,              "extension"},
     {kEventTypeFocus,                  "focus"},
     {kEventTypeFinish,                 "finish"},
+    {kEventTypeMediaCancel,            "mediaCancel"},
     {kEventTypeMediaRequest,           "mediaRequest"},
     {kEventTypeOpenURL,                "openURL"},
     {kEventTypePlayMedia,              "playMedia"},
@@ -110,7 +111,7 @@ Event::getValue(EventProperty key) const
 {
     auto it = mData->bag.find(key);
     if (it != mData->bag.end())
-        return mData->bag.at(key);
+        return it->second;
     return Object::NULL_OBJECT();
 }
 
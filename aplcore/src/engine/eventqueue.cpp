@@ -0,0 +1,63 @@
+/**
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#include <cassert>
+
+#include "apl/engine/eventqueue.h"
+
+namespace apl {
+
+void
+EventQueue::push(Event&& event)
+{
+    // Reclaim the popped slots once they make up most of the storage
+    if (mHead > 0 && mHead >= mEvents.size() / 2) {
+        mEvents.erase(mEvents.begin(), mEvents.begin() + mHead);
+        mHead = 0;
+    }
+
+    mEvents.emplace_back(std::move(event));
+}
+
+Event
+EventQueue::pop()
+{
+    assert(!empty());
+
+    Event event = std::move(mEvents[mHead++]);
+    if (mHead == mEvents.size())
+        clear();
+    return event;
+}
+
+size_t
+EventQueue::drain(std::vector<Event>& events)
+{
+    auto count = size();
+    events.reserve(events.size() + count);
+    for (auto i = mHead ; i < mEvents.size() ; i++)
+        events.emplace_back(std::move(mEvents[i]));
+    clear();
+    return count;
+}
+
+void
+EventQueue::clear()
+{
+    mEvents.clear();
+    mHead = 0;
+}
+
+} // namespace apl
@@ -16,10 +16,12 @@
 #include "apl/engine/layoutmanager.h"
 #include "apl/component/corecomponent.h"
 #include "apl/content/configurationchange.h"
+#include "apl/content/rootconfig.h"
 #include "apl/engine/rootcontextdata.h"
 #include "apl/livedata/layoutrebuilder.h"
 #include "apl/primitives/size.h"
 #include "apl/utils/tracing.h"
+#include "apl/utils/workerpool.h"
 
 namespace apl {
 
@@ -41,6 +43,8 @@ LayoutManager::LayoutManager(const apl::RootContextData& core)
 {
 }
 
+LayoutManager::~LayoutManager() = default;
+
 void
 LayoutManager::terminate()
 {
@@ -88,21 +92,32 @@ LayoutManager::configChange(const ConfigurationChange& change)
         mPendingLayout.emplace(top);
 }
 
-static bool
-compareComponents(const CoreComponentPtr& a, const CoreComponentPtr& b)
+/**
+ * Sort components from top to bottom, so that ancestors come before their descendants.  The depth
+ * of each component is calculated once instead of walking the hierarchy on every comparison.
+ */
+static std::vector<CoreComponentPtr>
+sortByDepth(const std::set<CoreComponentPtr>& components)
 {
-    if (a == b)
-        return false;
-
-    // Check if 'b' is a child of 'a'
-    auto parent = b->getParent();
-    while (parent) {
-        if (parent == a)
-            return true;
-        parent = parent->getParent();
+    std::vector<std::pair<size_t, CoreComponentPtr>> byDepth;
+    byDepth.reserve(components.size());
+    for (const auto& component : components) {
+        size_t depth = 0;
+        for (auto parent = component->getParent(); parent; parent = parent->getParent())
+            depth++;
+        byDepth.emplace_back(depth, component);
     }
 
-    return false;
+    std::stable_sort(byDepth.begin(), byDepth.end(),
+                     [](const std::pair<size_t, CoreComponentPtr>& a, const std::pair<size_t, CoreComponentPtr>& b) {
+                         return a.first < b.first;
+                     });
+
+    std::vector<CoreComponentPtr> result;
+    result.reserve(byDepth.size());
+    for (auto& m : byDepth)
+        result.emplace_back(std::move(m.second));
+    return result;
 }
 
 void
@@ -116,23 +131,53 @@ LayoutManager::layout(bool useDirtyFlag, bool first)
     APL_TRACE_BLOCK("LayoutManager:layout");
 
     std::set<CoreComponentPtr> laidOut;
+    std::set<CoreComponentPtr> deferred;
+    mPassStatistics = PassStatistics();
+    auto workers = static_cast<size_t>(mCore.rootConfig().getProperty(RootProperty::kLayoutWorkerThreads).getInteger());
 
     mInLayout = true;
     while (needsLayout()) {
         LOG_IF(DEBUG_LAYOUT_MANAGER) << "Laying out " << mPendingLayout.size() << " component(s)";
 
         // Copy the pending components into a vector and sort them from top to bottom
-        std::vector<CoreComponentPtr> dirty(mPendingLayout.begin(), mPendingLayout.end());
-        std::sort(dirty.begin(), dirty.end(), compareComponents);
+        auto dirty = sortByDepth(mPendingLayout);
         mPendingLayout.clear();
 
+        if (workers > 0 && dirty.size() > 1) {
+            // The roots are laid out together, so the deadline is checked once for all of them
+            for (auto it = dirty.begin() ; it != dirty.end() ;) {
+                if (deferLayout(*it)) {
+                    deferred.emplace(*it);
+                    it = dirty.erase(it);
+                }
+                else {
+                    it++;
+                }
+            }
+            layoutConcurrently(dirty, workers, useDirtyFlag, first);
+        }
+        else {
+            for (const auto& m : dirty) {
+                if (deferLayout(m))
+                    deferred.emplace(m);
+                else
+                    layoutComponent(m, useDirtyFlag, first);
+            }
+        }
+
         for (const auto& m : dirty) {
-            layoutComponent(m, useDirtyFlag, first);
-            laidOut.emplace(m);
+            if (!deferred.count(m))
+                laidOut.emplace(m);
         }
     }
     mInLayout = false;
 
+    // Deferred components are laid out by a later pass
+    mPendingLayout.insert(deferred.begin(), deferred.end());
+
+    LOG_IF(DEBUG_LAYOUT_MANAGER) << "Visited " << mPassStatistics.visited << " component(s), "
+                                 << mPassStatistics.changed << " changed";
+
     // Post-process all of the layouts.  This may result in scroll commands or other "jumping around"
     // actions, which can toggle more pending layouts.
     auto postProcess = mPostProcess;
@@ -146,6 +191,29 @@ LayoutManager::layout(bool useDirtyFlag, bool first)
         m->postProcessLayoutChanges();
 }
 
+/**
+ * Once the deadline has passed, layout roots that are not on screen wait for a later pass.  The top of the
+ * document is always laid out.  Other layout roots are pager pages; the current page and any page displayed
+ * during a page move are laid out too.
+ */
+bool
+LayoutManager::deferLayout(const CoreComponentPtr& component) const
+{
+    if (!pastDeadline())
+        return false;
+
+    auto parent = std::static_pointer_cast<CoreComponent>(component->getParent());
+    if (!parent)
+        return false;
+
+    auto currentPage = parent->getCalculated(kPropertyCurrentPage);
+    if (currentPage.isNumber() && currentPage.getInteger() < parent->getChildCount() &&
+        parent->getChildAt(currentPage.getInteger()) == component)
+        return false;
+
+    return !parent->isDisplayedChild(*component);
+}
+
 void
 LayoutManager::flushLazyInflation()
 {
@@ -189,8 +257,8 @@ LayoutManager::layoutComponent(const CoreComponentPtr& component, bool useDirtyF
                                  << " dirty_flag=" << useDirtyFlag
                                  << " parent=" << (parent ? parent->toDebugSimpleString() : "none");
 
-    Size size = parent ? parent->getCalculated(kPropertyInnerBounds).getRect().getSize() : mConfiguredSize;
-    if (size.empty())
+    Size size;
+    if (!layoutSize(component, size))
         return;
 
     auto node = component->getNode();
@@ -201,19 +269,115 @@ LayoutManager::layoutComponent(const CoreComponentPtr& component, bool useDirtyF
         APL_TRACE_BEGIN("LayoutManager:YGNodeCalculateLayout");
         YGNodeCalculateLayout(node, size.getWidth(), size.getHeight(), component->getLayoutDirection());
         APL_TRACE_END("LayoutManager:YGNodeCalculateLayout");
-        component->processLayoutChanges(useDirtyFlag, first);
-
-        if (mNeedToReProcessLayoutChanges) {
-            // Previous call may have changed sizes for auto-sized components if any lazyness involved. Apply this changes.
-            component->processLayoutChanges(useDirtyFlag, first);
-            mNeedToReProcessLayoutChanges = false;
-        }
+        processLayout(component, useDirtyFlag, first);
     }
 
     // Cache the laid-out size of the component.
     component->setLayoutSize(size);
 }
 
+void
+LayoutManager::layoutConcurrently(const std::vector<CoreComponentPtr>& components, size_t workers,
+                                  bool useDirtyFlag, bool first)
+{
+    APL_TRACE_BLOCK("LayoutManager:layoutConcurrently");
+
+    struct Job {
+        CoreComponentPtr component;
+        Size size;
+        YGDirection direction;
+        bool calculate;
+    };
+
+    std::set<Component*> pending;
+    for (const auto& m : components)
+        pending.emplace(m.get());
+
+    // Components without a pending ancestor head disjoint Yoga hierarchies and already know their
+    // target size.  The others must wait for their ancestors to be laid out.
+    std::vector<Job> independent;
+    std::vector<CoreComponentPtr> dependent;
+    for (const auto& m : components) {
+        bool hasPendingAncestor = false;
+        for (auto parent = m->getParent(); parent && !hasPendingAncestor; parent = parent->getParent())
+            hasPendingAncestor = pending.count(parent.get()) > 0;
+
+        if (hasPendingAncestor) {
+            dependent.emplace_back(m);
+            continue;
+        }
+
+        Size size;
+        if (!layoutSize(m, size))
+            continue;
+
+        bool calculate = YGNodeIsDirty(m->getNode()) || size != m->getLayoutSize();
+        if (calculate)
+            m->preLayoutProcessing(useDirtyFlag);
+        independent.emplace_back(Job{m, size, m->getLayoutDirection(), calculate});
+    }
+
+    std::vector<const Job*> calculations;
+    for (const auto& job : independent)
+        if (job.calculate)
+            calculations.emplace_back(&job);
+
+    LOG_IF(DEBUG_LAYOUT_MANAGER) << "Calculating " << calculations.size() << " independent layout(s)";
+
+    // The pool is created on first use and lives as long as the document
+    if (!mWorkerPool && calculations.size() > 1)
+        mWorkerPool.reset(new WorkerPool(workers));
+
+    // The Yoga calculations touch only their own hierarchy and the text measurement callbacks
+    APL_TRACE_BEGIN("LayoutManager:YGNodeCalculateLayout:concurrent");
+    mConcurrent = calculations.size() > 1;
+    if (mConcurrent) {
+        mPassStatistics.concurrent += calculations.size();
+        mPassStatistics.threads = std::max(mPassStatistics.threads,
+                                           std::min(calculations.size(), mWorkerPool->size() + 1));
+        mWorkerPool->run(calculations.size(), [&](size_t index) {
+            const auto& job = *calculations.at(index);
+            YGNodeCalculateLayout(job.component->getNode(), job.size.getWidth(), job.size.getHeight(), job.direction);
+        });
+    }
+    else {
+        for (const auto& job : calculations)
+            YGNodeCalculateLayout(job->component->getNode(), job->size.getWidth(), job->size.getHeight(), job->direction);
+    }
+    mConcurrent = false;
+    APL_TRACE_END("LayoutManager:YGNodeCalculateLayout:concurrent");
+
+    // Process the results on this thread, from top to bottom, so that the outcome matches a serial layout
+    for (const auto& job : independent) {
+        if (job.calculate)
+            processLayout(job.component, useDirtyFlag, first);
+        job.component->setLayoutSize(job.size);
+    }
+
+    for (const auto& m : dependent)
+        layoutComponent(m, useDirtyFlag, first);
+}
+
+bool
+LayoutManager::layoutSize(const CoreComponentPtr& component, Size& size) const
+{
+    auto parent = component->getParent();
+    size = parent ? parent->getCalculated(kPropertyInnerBounds).getRect().getSize() : mConfiguredSize;
+    return !size.empty();
+}
+
+void
+LayoutManager::processLayout(const CoreComponentPtr& component, bool useDirtyFlag, bool first)
+{
+    component->processLayoutChanges(useDirtyFlag, first);
+
+    if (mNeedToReProcessLayoutChanges) {
+        // Previous call may have changed sizes for auto-sized components if any lazyness involved. Apply this changes.
+        component->processLayoutChanges(useDirtyFlag, first);
+        mNeedToReProcessLayoutChanges = false;
+    }
+}
+
 
 void
 LayoutManager::requestLayout(const CoreComponentPtr& component, bool force)
@@ -32,8 +32,8 @@ namespace apl {
 std::string
 Properties::asLabel(const Context& context, const char *name)
 {
-    auto s = mProperties.find(name);
-    if (s == mProperties.end())
+    auto s = find(name);
+    if (s == end())
         return "";
 
     auto result = evaluate(context, s->second).asString();
@@ -45,8 +45,8 @@ Properties::asLabel(const Context& context, const char *name)
 std::string
 Properties::asString(const Context& context, const char *name, const char *defvalue)
 {
-    auto s = mProperties.find(name);
-    if (s == mProperties.end())
+    auto s = find(name);
+    if (s == end())
         return defvalue;
 
     return evaluate(context, s->second).asString();
@@ -55,8 +55,8 @@ Properties::asString(const Context& context, const char *name, const char *defva
 bool
 Properties::asBoolean(const Context& context, const char *name, bool defvalue)
 {
-    auto s = mProperties.find(name);
-    if (s == mProperties.end())
+    auto s = find(name);
+    if (s == end())
         return defvalue;
 
     return evaluate(context, s->second).asBoolean();
@@ -65,8 +65,8 @@ Properties::asBoolean(const Context& context, const char *name, bool defvalue)
 double
 Properties::asNumber(const Context& context, const char *name, double defvalue)
 {
-    auto s = mProperties.find(name);
-    if (s == mProperties.end())
+    auto s = find(name);
+    if (s == end())
         return defvalue;
 
     return evaluate(context, s->second).asNumber();
@@ -75,26 +75,61 @@ Properties::asNumber(const Context& context, const char *name, double defvalue)
 Dimension
 Properties::asAbsoluteDimension(const Context& context, const char *name, double defvalue)
 {
-    auto s = mProperties.find(name);
-    if (s == mProperties.end())
+    auto s = find(name);
+    if (s == end())
         return Dimension(DimensionType::Absolute, defvalue);
 
     return evaluate(context, s->second).asAbsoluteDimension(context);
 }
 
+const ObjectMap&
+Properties::properties() const
+{
+    static const ObjectMap sEmpty;
+    return mProperties ? *mProperties : sEmpty;
+}
+
+ObjectMap&
+Properties::mutableProperties()
+{
+    if (!mProperties)
+        mProperties = std::make_shared<ObjectMap>();
+    else if (mProperties.use_count() > 1)
+        mProperties = std::make_shared<ObjectMap>(*mProperties);
+
+    return *mProperties;
+}
+
 void
 Properties::emplace(const Object& item)
 {
     if (!item.isMap())
         return;
 
+    auto& map = mutableProperties();
     for (const auto& kv : item.getMap()) {
-        const std::string name = kv.first;
+        const std::string& name = kv.first;
         if (name == "type" || name == "when")
             continue;
         // Note that this doesn't override an existing one (deliberately!)
-        mProperties.emplace(name, kv.second);
+        map.emplace(name, kv.second);
+    }
+}
+
+void
+Properties::emplace(const Properties& other)
+{
+    if (other.empty())
+        return;
+
+    if (empty()) {
+        mProperties = other.mProperties;
+        return;
     }
+
+    auto& map = mutableProperties();
+    for (const auto& kv : other)
+        map.emplace(kv.first, kv.second);
 }
 
 void
@@ -105,10 +140,10 @@ Properties::addToContext(const ContextPtr &context, const Parameter &parameter,
     Object result;
     auto bindingFunc = sBindingFunctions.at(parameter.type);
 
-    auto it = mProperties.find(parameter.name);
-    if (it != mProperties.end()) {
+    auto it = properties().find(parameter.name);
+    if (it != properties().end()) {
         tmp = it->second;
-        mProperties.erase(it);   // Remove the property from the list
+        mutableProperties().erase(parameter.name);   // Remove the property from the list
 
         // Extract as an optional node tree for dependant
         tmp = tmp.isString() ? parseDataBinding(*context, tmp.getString()) : tmp;
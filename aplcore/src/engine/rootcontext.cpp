@@ -30,6 +30,7 @@
 #include "apl/content/metrics.h"
 #include "apl/content/rootconfig.h"
 #include "apl/content/configurationchange.h"
+#include "apl/content/viewport.h"
 #include "apl/datasource/datasource.h"
 #include "apl/datasource/datasourceprovider.h"
 #include "apl/engine/builder.h"
@@ -37,6 +38,7 @@
 #include "apl/engine/rootcontext.h"
 #include "apl/engine/resources.h"
 #include "apl/engine/rootcontextdata.h"
+#include "apl/engine/tickhandler.h"
 #include "apl/graphic/graphic.h"
 #include "apl/livedata/livedataobject.h"
 #include "apl/livedata/livedataobjectwatcher.h"
@@ -156,8 +158,8 @@ RootContext::updateDisplayState(DisplayState displayState)
 void
 RootContext::reinflate()
 {
-    // The basic algorithm is to simply re-build core and re-inflate the component hierarchy.
-    // TODO: Re-use parts of the hierarchy and to maintain state during reinflation.
+    // The basic algorithm is to simply re-build core and re-inflate the component hierarchy.  If the
+    // document never read the values that changed, the change is applied to the existing hierarchy instead.
 
     // Release any "onConfigChange" action
     mCore->sequencer().terminateSequencer(ConfigChangeCommand::SEQUENCER);
@@ -169,6 +171,11 @@ RootContext::reinflate()
     config.utcTime(mUTCTime);
     config.localTimeAdjustment(mLocalTimeAdjustment);
 
+    if (config.getProperty(RootProperty::kIncrementalReinflation).asBoolean() && reinflateInPlace(metrics, config)) {
+        mActiveConfigurationChanges.clear();
+        return;
+    }
+
     // Stop any execution on the old core
     auto oldTop = mCore->halt();
     // Ensure that nothing is pending.
@@ -186,6 +193,75 @@ RootContext::reinflate()
     mActiveConfigurationChanges.clear();
 }
 
+static void
+markMeasuredNodesDirty(const CoreComponentPtr& component)
+{
+    if (YGNodeHasMeasureFunc(component->getNode()))
+        YGNodeMarkDirty(component->getNode());
+
+    for (size_t i = 0; i < component->getChildCount(); i++)
+        markMeasuredNodesDirty(component->getCoreChildAt(i));
+}
+
+bool
+RootContext::reinflateInPlace(const Metrics& metrics, const RootConfig& config)
+{
+    APL_TRACE_BLOCK("RootContext:reinflateInPlace");
+
+    // The theme selects styles, resources, and default colors throughout the hierarchy
+    if (metrics.getTheme() != mCore->mMetrics.getTheme())
+        return false;
+
+    auto reads = mCore->environmentReads();
+    auto observed = [&](const std::string& object, const std::string& key) {
+        return (reads & environmentReadFlags(object, key)) != 0;
+    };
+
+    auto oldViewport = mContext->opt("viewport");
+    auto viewport = makeViewport(metrics, mCore->getTheme());
+    for (const auto& m : viewport.getMap())
+        if (oldViewport.get(m.first) != m.second && observed("viewport", m.first))
+            return false;
+
+    auto environment = std::make_shared<ObjectMap>(mContext->opt("environment").getMap());
+    auto update = [&](const std::string& key, const Object& value) {
+        auto it = environment->find(key);
+        if (it != environment->end() && it->second == value)
+            return true;
+        if (observed("environment", key))
+            return false;
+        (*environment)[key] = value;
+        return true;
+    };
+
+    auto fontScaleChanged = config.getFontScale() != mCore->mConfig.getFontScale();
+    if (!update("fontScale", config.getFontScale()) ||
+        !update("screenMode", config.getScreenMode()) ||
+        !update("screenReader", config.getScreenReaderEnabled()) ||
+        !update("reason", "reinflation"))
+        return false;
+
+    LOG(LogLevel::kDebug) << "Applying configuration change without re-inflation";
+
+    mCore->mMetrics = metrics;
+    mCore->mConfig = config;
+    mCore->mRuntimeState = RuntimeState(mCore->getTheme(), mCore->getRequestedAPLVersion(), true);
+    mContext->updateConstant("viewport", viewport);
+    mContext->updateConstant("environment", Object(environment));
+
+    // Text is re-measured at the new scale
+    auto top = mCore->top();
+    if (fontScaleChanged) {
+        mCore->cachedMeasures().clear();
+        mCore->cachedBaselines().clear();
+        if (top)
+            markMeasuredNodesDirty(top);
+    }
+
+    mCore->layoutManager().configChange(mActiveConfigurationChanges);
+    return true;
+}
+
 void
 RootContext::resize()
 {
@@ -251,6 +327,20 @@ RootContext::clearPending() const
     clearPendingInternal(false);
 }
 
+bool
+RootContext::clearPending(apl_duration_t budget) const
+{
+    assert(mCore);
+
+    auto& layoutManager = mCore->layoutManager();
+    auto duration = std::chrono::duration<apl_duration_t, std::milli>(budget);
+    layoutManager.setDeadline(LayoutManager::Clock::now() + std::chrono::duration_cast<LayoutManager::Clock::duration>(duration));
+    clearPendingInternal(false);
+    layoutManager.clearDeadline();
+
+    return layoutManager.needsLayout();
+}
+
 void
 RootContext::clearPendingInternal(bool first) const
 {
@@ -299,11 +389,8 @@ RootContext::clearPendingInternal(bool first) const
     // Process any extension events. There are no need to expose those externally.
     auto extensionMediator = mCore->rootConfig().getExtensionMediator();
     if (extensionMediator) {
-        while (!mCore->extesnionEvents.empty()) {
-            Event event = mCore->extesnionEvents.front();
-            mCore->extesnionEvents.pop();
-            extensionMediator->invokeCommand(event);
-        }
+        while (!mCore->extesnionEvents.empty())
+            extensionMediator->invokeCommand(mCore->extesnionEvents.pop());
     }
 #endif
 }
@@ -322,17 +409,23 @@ RootContext::popEvent()
     assert(mCore);
     clearPending();
 
-    if (!mCore->events.empty()) {
-        Event event = mCore->events.front();
-        mCore->events.pop();
-        return event;
-    }
+    if (!mCore->events.empty())
+        return mCore->events.pop();
 
     // This should never be reached.
     LOG(LogLevel::kError) << "No events available";
     std::exit(EXIT_FAILURE);
 }
 
+size_t
+RootContext::drainEvents(std::vector<Event>& events)
+{
+    assert(mCore);
+    clearPending();
+
+    return mCore->events.drain(events);
+}
+
 bool
 RootContext::isDirty() const
 {
@@ -730,25 +823,24 @@ RootContext::setup(const CoreComponentPtr& top)
 }
 
 void
-RootContext::scheduleTickHandler(const Object& handler, double delay) {
+RootContext::scheduleTickHandler(const Object& handler) {
     auto weak_ptr = std::weak_ptr<RootContext>(shared_from_this());
+    TickHandler tick(*mContext, handler);
 
-    // Lambda capture takes care of handler here as it's a copy.
-    mTimeManager->setTimeout([weak_ptr, handler, delay]() {
+    // Document event properties never change, so every tick shares one context
+    auto ctx = createDocumentContext("Tick");
+
+    mTimeManager->setInterval([weak_ptr, tick, ctx]() {
         auto self = weak_ptr.lock();
         if (!self)
-            return;
-
-        auto ctx = self->createDocumentContext("Tick");
-        if (propertyAsBoolean(*ctx, handler, "when", true)) {
-            auto commands = Object(arrayifyProperty(*ctx, handler, "commands"));
-            if (!commands.empty())
-                self->context().sequencer().executeCommands(commands, ctx, nullptr, true);
-        }
+            return false;
 
-        self->scheduleTickHandler(handler, delay);
+        auto commands = tick.commands(*ctx);
+        if (!commands.empty())
+            self->context().sequencer().executeCommands(commands, ctx, nullptr, true);
 
-    }, delay);
+        return true;
+    }, tick.delay());
 }
 
 void
@@ -763,11 +855,8 @@ RootContext::processTickHandlers() {
     if (tickHandlers.empty() || !tickHandlers.isArray())
         return;
 
-    for (const auto& handler : tickHandlers.getArray()) {
-        auto delay = std::max(propertyAsDouble(*mContext, handler, "minimumDelay", 1000),
-                mCore->rootConfig().getTickHandlerUpdateLimit());
-        scheduleTickHandler(handler, delay);
-    }
+    for (const auto& handler : tickHandlers.getArray())
+        scheduleTickHandler(handler);
 }
 
 bool
@@ -837,6 +926,12 @@ RootContext::handlePointerEvent(const PointerEvent& pointerEvent) {
     return mCore->pointerManager().handlePointerEvent(pointerEvent, mTimeManager->currentTime());
 }
 
+bool
+RootContext::handlePointerEvents(const std::vector<PointerSample>& samples) {
+    assert(mCore);
+    return mCore->pointerManager().handlePointerEvents(samples, mTimeManager->currentTime());
+}
+
 const RootConfig&
 RootContext::getRootConfig() const
 {
@@ -29,6 +29,10 @@ namespace apl {
 
 static const bool DEBUG_YG_PRINT_TREE = false;
 
+// Number of distinct command definitions whose compiled templates are retained
+static const size_t COMMAND_TEMPLATE_CACHE_LIMIT = 500;
+static const size_t PATH_GEOMETRY_CACHE_LIMIT = 200;
+
 static LogLevel
 ygLevelToDebugLevel(YGLogLevel level)
 {
@@ -95,7 +99,10 @@ RootContextData::RootContextData(const Metrics& metrics,
       mSession(session),
       mLayoutDirection(kLayoutDirectionInherit),
       mCachedMeasures(config.getProperty(RootProperty::kTextMeasurementCacheLimit).getInteger()),
-      mCachedBaselines(config.getProperty(RootProperty::kTextMeasurementCacheLimit).getInteger())
+      mCachedBaselines(config.getProperty(RootProperty::kTextMeasurementCacheLimit).getInteger()),
+      mCommandTemplates(COMMAND_TEMPLATE_CACHE_LIMIT),
+      mPathGeometries(PATH_GEOMETRY_CACHE_LIMIT),
+      mTrackEnvironmentReads(config.getProperty(RootProperty::kIncrementalReinflation).asBoolean())
 {
     YGConfigSetPrintTreeFlag(mYGConfigRef, DEBUG_YG_PRINT_TREE);
     YGConfigSetLogger(mYGConfigRef, ygLogger);
@@ -122,7 +129,7 @@ RootContextData::halt()
     }
 
     // Clear any pending events and dirty components
-    events = std::queue<Event>();
+    events.clear();
     dirty.clear();
     dirtyVisualContext.clear();
 
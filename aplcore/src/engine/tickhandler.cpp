@@ -0,0 +1,65 @@
+/**
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#include "apl/engine/tickhandler.h"
+#include "apl/content/rootconfig.h"
+#include "apl/engine/arrayify.h"
+#include "apl/engine/evaluate.h"
+
+namespace apl {
+
+/**
+ * True if array-ifying the value gives the same result in any context.  Only strings are evaluated,
+ * either at the top level or as direct array elements.
+ */
+static bool
+isStaticArray(const Object& value)
+{
+    if (value.isString())
+        return false;
+
+    if (value.isArray()) {
+        for (const auto& m : value.getArray())
+            if (m.isString())
+                return false;
+    }
+
+    return true;
+}
+
+TickHandler::TickHandler(const Context& context, const Object& handler)
+    : mHandler(handler),
+      mDelay(std::max(propertyAsDouble(context, handler, "minimumDelay", 1000),
+                      context.getRootConfig().getTickHandlerUpdateLimit()))
+{
+    if (!handler.isMap() || !handler.has("commands"))
+        mCommands = Object::EMPTY_ARRAY();
+    else if (isStaticArray(handler.get("commands")))
+        mCommands = Object(arrayifyProperty(context, handler, "commands"));
+}
+
+Object
+TickHandler::commands(const Context& context) const
+{
+    if (!propertyAsBoolean(context, mHandler, "when", true))
+        return Object::EMPTY_ARRAY();
+
+    if (!mCommands.isNull())
+        return mCommands;
+
+    return Object(arrayifyProperty(context, mHandler, "commands"));
+}
+
+} // namespace apl
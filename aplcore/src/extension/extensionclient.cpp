@@ -400,7 +400,7 @@ ExtensionClient::liveDataObjectFlushed(const std::string& key, LiveDataObject& l
         return;
     }
 
-    auto ref = mLiveData.at(key);
+    const auto& ref = mLiveData.at(key);
     switch (ref.objectType) {
         case kExtensionLiveDataTypeArray:
             reportLiveArrayChanges(rootContext, ref, liveDataObject);
@@ -433,10 +433,10 @@ ExtensionClient::reportLiveMapChanges(const RootContextPtr& rootContext, const L
     std::string removeTriggerEvent = ref.removeEvent.name;
 
     auto mapPtr = std::make_shared<ObjectMap>(std::dynamic_pointer_cast<LiveMap>(ref.objectPtr)->getMap());
-    auto changes = dynamic_cast<LiveMapObject&>(liveDataObject).getChanges();
+    const auto& changes = dynamic_cast<LiveMapObject&>(liveDataObject).getChanges();
 
-    for (auto& change : changes) {
-        auto key = change.key();
+    for (const auto& change : changes) {
+        const auto& key = change.key();
         auto changed = std::make_shared<ObjectMap>();
         switch (change.command()) {
             case LiveMapChange::Command::SET:
@@ -491,11 +491,9 @@ ExtensionClient::reportLiveArrayChanges(const RootContextPtr& rootContext, const
     std::string removeTriggerEvent;
 
     auto arrayPtr = std::make_shared<ObjectArray>(std::dynamic_pointer_cast<LiveArray>(ref.objectPtr)->getArray());
-    auto changes = dynamic_cast<LiveArrayObject&>(liveDataObject).getChanges();
-
-    for (auto& change : changes) {
-        std::string triggerEvent;
+    const auto& changes = dynamic_cast<LiveArrayObject&>(liveDataObject).getChanges();
 
+    for (const auto& change : changes) {
         switch (change.command()) {
             case LiveArrayChange::Command::INSERT :
                 addTriggerEvent = ref.addEvent.name;
@@ -551,7 +549,7 @@ ExtensionClient::processLiveDataUpdate(const Context& context, const Object& upd
         return false;
     }
 
-    auto dataRef = mLiveData.at(name.getString());
+    const auto& dataRef = mLiveData.at(name.getString());
     for (const auto& operation : operations.getArray()) {
         auto type = propertyAsMapped<ExtensionLiveDataUpdateType>(context, operation, "type",
                 static_cast<ExtensionLiveDataUpdateType>(-1), sExtensionLiveDataUpdateTypeBimap);
@@ -598,7 +596,6 @@ ExtensionClient::updateLiveMap(ExtensionLiveDataUpdateType type, const LiveDataR
         return false;
     }
     const auto& key = keyObj.getString();
-    auto typeDef = mTypes.at(dataRef.type);
     auto item = operation.get("item");
 
     auto liveMap = std::dynamic_pointer_cast<LiveMap>(dataRef.objectPtr);
@@ -1200,6 +1197,7 @@ ExtensionClient::createComponentChange(rapidjson::MemoryPoolAllocator<>& allocat
         // include the viewport
         const auto& contextref = component.getContext()->find("viewport");
         if (!contextref.empty()) {
+            component.getContext()->recordEnvironmentRead(kEnvironmentReadViewport);
             result->emplace("viewport", contextref.object().value());
         }
 
@@ -287,14 +287,24 @@ void
 ExtensionMediator::enqueueResponse(const std::string& uri, const rapidjson::Value& message)
 {
     std::weak_ptr<ExtensionMediator> weak_this = shared_from_this();
-    // TODO optimize
-    auto copy = std::make_shared<rapidjson::Document>();
-    copy->CopyFrom(message, copy->GetAllocator());
-    bool enqueued = mMessageExecutor->enqueueTask([weak_this, uri, copy] () {
-        if (auto mediator = weak_this.lock()) {
-            mediator->processMessage(uri, *copy);
-        }
-    });
+    bool enqueued;
+    if (mMessageExecutor->isSynchronous()) {
+        // The message outlives the task, so it is read in place
+        enqueued = mMessageExecutor->enqueueTask([weak_this, &uri, &message] () {
+            if (auto mediator = weak_this.lock()) {
+                mediator->processMessage(uri, message);
+            }
+        });
+    } else {
+        // The callback only lends us the message, so a deferred task needs its own copy
+        auto copy = std::make_shared<rapidjson::Document>();
+        copy->CopyFrom(message, copy->GetAllocator());
+        enqueued = mMessageExecutor->enqueueTask([weak_this, uri, copy] () {
+            if (auto mediator = weak_this.lock()) {
+                mediator->processMessage(uri, *copy);
+            }
+        });
+    }
     if (!enqueued)
         LOG(LogLevel::kWarn) << "failed to process message for extension, uri:" << uri;
 }
@@ -14,6 +14,7 @@
  */
 
 #include "apl/graphic/graphicelementpath.h"
+#include "apl/graphic/graphicpathgeometry.h"
 #include "apl/graphic/graphicpropdef.h"
 
 namespace apl {
@@ -44,7 +45,7 @@ GraphicElementPath::propDefSet() const
                  {kGraphicPropertyFillTransform,           Object::IDENTITY_2D(), nullptr,               kPropOut},
                  {kGraphicPropertyFillTransformAssigned,   "",                    asString,              kPropIn | kPropDynamic, fixFillTransform},
                  {kGraphicPropertyFilters,                 Object::EMPTY_ARRAY(), asGraphicFilterArray,  kPropInOut},
-                 {kGraphicPropertyPathData,                "",                    asString,              kPropInOut | kPropRequired | kPropDynamic},
+                 {kGraphicPropertyPathData,                "",                    asString,              kPropInOut | kPropRequired | kPropDynamic, fixPathGeometry},
                  {kGraphicPropertyPathLength,              0,                     asNumber,              kPropInOut | kPropDynamic},
                  {kGraphicPropertyStroke,                  Color(),               asAvgFill,             kPropInOut | kPropDynamic | kPropEvaluated},
                  {kGraphicPropertyStrokeDashArray,         Object::EMPTY_ARRAY(), asDashArray,           kPropInOut | kPropDynamic | kPropEvaluated},
@@ -71,7 +72,16 @@ GraphicElementPath::initialize(const GraphicPtr& graphic, const Object& json)
     updateTransform(*mContext, kGraphicPropertyFillTransformAssigned, kGraphicPropertyFillTransform, false);
     updateTransform(*mContext, kGraphicPropertyStrokeTransformAssigned, kGraphicPropertyStrokeTransform, false);
 
+    mGeometry = GraphicPathGeometry::create(*mContext, mValues.get(kGraphicPropertyPathData).getString());
+
     return true;
 }
 
+void
+GraphicElementPath::fixPathGeometry(GraphicElement& element)
+{
+    auto& path = static_cast<GraphicElementPath&>(element);
+    path.mGeometry = GraphicPathGeometry::create(*path.mContext, path.mValues.get(kGraphicPropertyPathData).getString());
+}
+
 }  // namespace apl
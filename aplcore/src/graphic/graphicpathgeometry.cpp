@@ -0,0 +1,658 @@
+/**
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#include <algorithm>
+#include <cctype>
+#include <cmath>
+#include <limits>
+
+#include "apl/engine/context.h"
+#include "apl/graphic/graphicpathgeometry.h"
+#include "apl/utils/log.h"
+
+namespace apl {
+
+// Number of straight segments used to approximate the length of a curve
+static const int CURVE_LENGTH_SEGMENTS = 16;
+
+static const double PI = 3.14159265358979323846;
+
+namespace {
+
+inline bool
+isSeparator(char c)
+{
+    return c == ' ' || c == ',' || c == '\t' || c == '\n' || c == '\r' || c == '\f';
+}
+
+inline bool
+isDigit(char c)
+{
+    return c >= '0' && c <= '9';
+}
+
+/**
+ * Single-pass parser for the SVG path mini-language.  Emits absolute commands into the
+ * command and point buffers.
+ */
+class PathParser {
+public:
+    PathParser(const std::string& data, std::vector<GraphicPathCommand>& commands, std::vector<float>& points)
+        : mData(data), mCommands(commands), mPoints(points) {}
+
+    /**
+     * Parse the path.  Returns false if a syntax error was found; the buffers hold the
+     * commands parsed before the error.
+     */
+    bool parse()
+    {
+        char command = 0;
+        skipSeparators();
+        while (mOffset < mData.size()) {
+            char c = mData[mOffset];
+            if (std::isalpha(static_cast<unsigned char>(c))) {
+                command = c;
+                mOffset++;
+            }
+            else if (command == 0 || command == 'z' || command == 'Z') {
+                return false;   // Numbers without a command
+            }
+
+            if (!parseCommand(command))
+                return false;
+
+            // Subsequent coordinate pairs after a move are treated as lines
+            if (command == 'M') command = 'L';
+            else if (command == 'm') command = 'l';
+
+            skipSeparators();
+        }
+        return true;
+    }
+
+private:
+    bool parseCommand(char command)
+    {
+        bool relative = std::islower(static_cast<unsigned char>(command)) != 0;
+        float dx = relative ? mX : 0;
+        float dy = relative ? mY : 0;
+
+        switch (std::toupper(static_cast<unsigned char>(command))) {
+            case 'M': {
+                float x, y;
+                if (!readNumber(x) || !readNumber(y)) return false;
+                moveTo(x + dx, y + dy);
+                return true;
+            }
+            case 'L': {
+                float x, y;
+                if (!readNumber(x) || !readNumber(y)) return false;
+                lineTo(x + dx, y + dy);
+                return true;
+            }
+            case 'H': {
+                float x;
+                if (!readNumber(x)) return false;
+                lineTo(x + dx, mY);
+                return true;
+            }
+            case 'V': {
+                float y;
+                if (!readNumber(y)) return false;
+                lineTo(mX, y + dy);
+                return true;
+            }
+            case 'C': {
+                float v[6];
+                for (auto& n : v)
+                    if (!readNumber(n)) return false;
+                cubicTo(v[0] + dx, v[1] + dy, v[2] + dx, v[3] + dy, v[4] + dx, v[5] + dy);
+                return true;
+            }
+            case 'S': {
+                float v[4];
+                for (auto& n : v)
+                    if (!readNumber(n)) return false;
+                float cx = mX, cy = mY;
+                if (mLastCommand == kGraphicPathCommandCubicTo) {
+                    cx = 2 * mX - mControlX;
+                    cy = 2 * mY - mControlY;
+                }
+                cubicTo(cx, cy, v[0] + dx, v[1] + dy, v[2] + dx, v[3] + dy);
+                return true;
+            }
+            case 'Q': {
+                float v[4];
+                for (auto& n : v)
+                    if (!readNumber(n)) return false;
+                quadTo(v[0] + dx, v[1] + dy, v[2] + dx, v[3] + dy);
+                return true;
+            }
+            case 'T': {
+                float x, y;
+                if (!readNumber(x) || !readNumber(y)) return false;
+                float cx = mX, cy = mY;
+                if (mLastCommand == kGraphicPathCommandQuadTo) {
+                    cx = 2 * mX - mControlX;
+                    cy = 2 * mY - mControlY;
+                }
+                quadTo(cx, cy, x + dx, y + dy);
+                return true;
+            }
+            case 'A': {
+                float rx, ry, rotation, x, y;
+                bool largeArc, sweep;
+                if (!readNumber(rx) || !readNumber(ry) || !readNumber(rotation) ||
+                    !readFlag(largeArc) || !readFlag(sweep) || !readNumber(x) || !readNumber(y))
+                    return false;
+                arcTo(rx, ry, rotation, largeArc, sweep, x + dx, y + dy);
+                return true;
+            }
+            case 'Z':
+                close();
+                return true;
+            default:
+                return false;
+        }
+    }
+
+    void skipSeparators()
+    {
+        while (mOffset < mData.size() && isSeparator(mData[mOffset]))
+            mOffset++;
+    }
+
+    /**
+     * Read a single number in the SVG number format.  We parse the number manually to avoid
+     * locale-dependent conversion routines.
+     */
+    bool readNumber(float& result)
+    {
+        skipSeparators();
+        auto len = mData.size();
+        auto i = mOffset;
+
+        double sign = 1;
+        if (i < len && (mData[i] == '+' || mData[i] == '-')) {
+            if (mData[i] == '-') sign = -1;
+            i++;
+        }
+
+        double value = 0;
+        bool hasDigits = false;
+        while (i < len && isDigit(mData[i])) {
+            value = value * 10 + (mData[i] - '0');
+            hasDigits = true;
+            i++;
+        }
+
+        if (i < len && mData[i] == '.') {
+            i++;
+            double scale = 0.1;
+            while (i < len && isDigit(mData[i])) {
+                value += (mData[i] - '0') * scale;
+                scale *= 0.1;
+                hasDigits = true;
+                i++;
+            }
+        }
+
+        if (!hasDigits)
+            return false;
+
+        if (i < len && (mData[i] == 'e' || mData[i] == 'E')) {
+            auto j = i + 1;
+            int expSign = 1;
+            if (j < len && (mData[j] == '+' || mData[j] == '-')) {
+                if (mData[j] == '-') expSign = -1;
+                j++;
+            }
+            if (j < len && isDigit(mData[j])) {
+                int exponent = 0;
+                while (j < len && isDigit(mData[j])) {
+                    exponent = std::min(exponent * 10 + (mData[j] - '0'), 1000);
+                    j++;
+                }
+                value *= std::pow(10.0, expSign * exponent);
+                i = j;
+            }
+        }
+
+        mOffset = i;
+        result = static_cast<float>(sign * value);
+        return std::isfinite(result);
+    }
+
+    /**
+     * Arc flags are a single '0' or '1' and need not be separated from the following number.
+     */
+    bool readFlag(bool& result)
+    {
+        skipSeparators();
+        if (mOffset >= mData.size())
+            return false;
+
+        char c = mData[mOffset];
+        if (c != '0' && c != '1')
+            return false;
+
+        result = c == '1';
+        mOffset++;
+        return true;
+    }
+
+    void ensureStarted()
+    {
+        // Drawing commands after a close start from the last sub-path starting point
+        if (mNeedsMove) {
+            mCommands.push_back(kGraphicPathCommandMoveTo);
+            mPoints.push_back(mX);
+            mPoints.push_back(mY);
+            mNeedsMove = false;
+        }
+    }
+
+    void moveTo(float x, float y)
+    {
+        // Consecutive moves draw nothing; only the last one starts the sub-path
+        if (!mCommands.empty() && mCommands.back() == kGraphicPathCommandMoveTo) {
+            mPoints[mPoints.size() - 2] = x;
+            mPoints.back() = y;
+        }
+        else {
+            mCommands.push_back(kGraphicPathCommandMoveTo);
+            mPoints.push_back(x);
+            mPoints.push_back(y);
+        }
+        mX = mStartX = x;
+        mY = mStartY = y;
+        mNeedsMove = false;
+        mLastCommand = kGraphicPathCommandMoveTo;
+    }
+
+    void lineTo(float x, float y)
+    {
+        ensureStarted();
+        mCommands.push_back(kGraphicPathCommandLineTo);
+        mPoints.push_back(x);
+        mPoints.push_back(y);
+        mX = x;
+        mY = y;
+        mLastCommand = kGraphicPathCommandLineTo;
+    }
+
+    void quadTo(float cx, float cy, float x, float y)
+    {
+        ensureStarted();
+        mCommands.push_back(kGraphicPathCommandQuadTo);
+        mPoints.insert(mPoints.end(), {cx, cy, x, y});
+        mControlX = cx;
+        mControlY = cy;
+        mX = x;
+        mY = y;
+        mLastCommand = kGraphicPathCommandQuadTo;
+    }
+
+    void cubicTo(float c1x, float c1y, float c2x, float c2y, float x, float y)
+    {
+        ensureStarted();
+        mCommands.push_back(kGraphicPathCommandCubicTo);
+        mPoints.insert(mPoints.end(), {c1x, c1y, c2x, c2y, x, y});
+        mControlX = c2x;
+        mControlY = c2y;
+        mX = x;
+        mY = y;
+        mLastCommand = kGraphicPathCommandCubicTo;
+    }
+
+    void close()
+    {
+        if (mCommands.empty() || mCommands.back() == kGraphicPathCommandClose)
+            return;
+
+        mCommands.push_back(kGraphicPathCommandClose);
+        mX = mStartX;
+        mY = mStartY;
+        mNeedsMove = true;
+        mLastCommand = kGraphicPathCommandClose;
+    }
+
+    /**
+     * Convert an elliptical arc into a sequence of cubic curves.  This follows the
+     * endpoint-to-center parameterization in the SVG specification (Appendix F.6).
+     */
+    void arcTo(float rx, float ry, float rotation, bool largeArc, bool sweep, float x, float y)
+    {
+        double x1 = mX;
+        double y1 = mY;
+        if (x1 == x && y1 == y)
+            return;
+
+        rx = std::abs(rx);
+        ry = std::abs(ry);
+        if (rx == 0 || ry == 0) {
+            lineTo(x, y);
+            return;
+        }
+
+        double phi = std::fmod(rotation, 360.0) * PI / 180.0;
+        double cosPhi = std::cos(phi);
+        double sinPhi = std::sin(phi);
+
+        // Step 1: compute (x1', y1')
+        double hx = (x1 - x) / 2;
+        double hy = (y1 - y) / 2;
+        double x1p = cosPhi * hx + sinPhi * hy;
+        double y1p = -sinPhi * hx + cosPhi * hy;
+
+        // Correct out-of-range radii
+        double rxs = static_cast<double>(rx) * rx;
+        double rys = static_cast<double>(ry) * ry;
+        double lambda = (x1p * x1p) / rxs + (y1p * y1p) / rys;
+        double rxd = rx;
+        double ryd = ry;
+        if (lambda > 1) {
+            double s = std::sqrt(lambda);
+            rxd *= s;
+            ryd *= s;
+            rxs = rxd * rxd;
+            rys = ryd * ryd;
+        }
+
+        // Step 2: compute (cx', cy')
+        double num = rxs * rys - rxs * y1p * y1p - rys * x1p * x1p;
+        double den = rxs * y1p * y1p + rys * x1p * x1p;
+        double coef = den == 0 ? 0 : std::sqrt(std::max(0.0, num / den));
+        if (largeArc == sweep)
+            coef = -coef;
+        double cxp = coef * rxd * y1p / ryd;
+        double cyp = -coef * ryd * x1p / rxd;
+
+        // Step 3: compute (cx, cy)
+        double cx = cosPhi * cxp - sinPhi * cyp + (x1 + x) / 2;
+        double cy = sinPhi * cxp + cosPhi * cyp + (y1 + y) / 2;
+
+        // Step 4: compute the start angle and the sweep
+        double ux = (x1p - cxp) / rxd;
+        double uy = (y1p - cyp) / ryd;
+        double vx = (-x1p - cxp) / rxd;
+        double vy = (-y1p - cyp) / ryd;
+        double theta = std::atan2(uy, ux);
+        double delta = std::atan2(vy, vx) - theta;
+        if (sweep && delta < 0)
+            delta += 2 * PI;
+        else if (!sweep && delta > 0)
+            delta -= 2 * PI;
+
+        // Split into segments of at most 90 degrees
+        int segments = std::max(1, static_cast<int>(std::ceil(std::abs(delta) / (PI / 2) - 1e-6)));
+        double step = delta / segments;
+        double alpha = 4.0 / 3.0 * std::tan(step / 4);
+
+        double cosT = std::cos(theta);
+        double sinT = std::sin(theta);
+        for (int i = 0; i < segments; i++) {
+            double theta2 = theta + step;
+            double cosT2 = std::cos(theta2);
+            double sinT2 = std::sin(theta2);
+
+            // Unit circle control points, then scaled/rotated/translated into place
+            double p1x = cosT - alpha * sinT;
+            double p1y = sinT + alpha * cosT;
+            double p2x = cosT2 + alpha * sinT2;
+            double p2y = sinT2 - alpha * cosT2;
+
+            auto tx = [&](double ex, double ey) { return cx + rxd * ex * cosPhi - ryd * ey * sinPhi; };
+            auto ty = [&](double ex, double ey) { return cy + rxd * ex * sinPhi + ryd * ey * cosPhi; };
+
+            bool last = i == segments - 1;
+            cubicTo(static_cast<float>(tx(p1x, p1y)), static_cast<float>(ty(p1x, p1y)),
+                    static_cast<float>(tx(p2x, p2y)), static_cast<float>(ty(p2x, p2y)),
+                    last ? x : static_cast<float>(tx(cosT2, sinT2)),
+                    last ? y : static_cast<float>(ty(cosT2, sinT2)));
+
+            theta = theta2;
+            cosT = cosT2;
+            sinT = sinT2;
+        }
+    }
+
+private:
+    const std::string& mData;
+    std::vector<GraphicPathCommand>& mCommands;
+    std::vector<float>& mPoints;
+    size_t mOffset = 0;
+
+    float mX = 0, mY = 0;                // Current point
+    float mStartX = 0, mStartY = 0;      // Start of the current sub-path
+    float mControlX = 0, mControlY = 0;  // Last control point (for smooth curves)
+    bool mNeedsMove = true;              // A path without a leading move starts at the origin
+    GraphicPathCommand mLastCommand = kGraphicPathCommandMoveTo;
+};
+
+/**
+ * Track the extent of a set of points.
+ */
+class BoundsAccumulator {
+public:
+    void add(double x, double y) {
+        mMinX = std::min(mMinX, x);
+        mMaxX = std::max(mMaxX, x);
+        mMinY = std::min(mMinY, y);
+        mMaxY = std::max(mMaxY, y);
+    }
+
+    bool empty() const { return mMinX > mMaxX; }
+
+    Rect rect() const {
+        if (empty())
+            return {0, 0, 0, 0};
+        return {static_cast<float>(mMinX), static_cast<float>(mMinY),
+                static_cast<float>(mMaxX - mMinX), static_cast<float>(mMaxY - mMinY)};
+    }
+
+private:
+    double mMinX = std::numeric_limits<double>::max();
+    double mMaxX = std::numeric_limits<double>::lowest();
+    double mMinY = std::numeric_limits<double>::max();
+    double mMaxY = std::numeric_limits<double>::lowest();
+};
+
+inline double
+quadAt(double p0, double p1, double p2, double t)
+{
+    double mt = 1 - t;
+    return mt * mt * p0 + 2 * mt * t * p1 + t * t * p2;
+}
+
+inline double
+cubicAt(double p0, double p1, double p2, double p3, double t)
+{
+    double mt = 1 - t;
+    return mt * mt * mt * p0 + 3 * mt * mt * t * p1 + 3 * mt * t * t * p2 + t * t * t * p3;
+}
+
+/**
+ * Find the parameter values in (0,1) where the derivative of a cubic Bézier is zero.
+ * Returns the number of roots stored in "roots".
+ */
+int
+cubicExtrema(double p0, double p1, double p2, double p3, double roots[2])
+{
+    // Derivative / 3 = a t^2 + b t + c
+    double a = -p0 + 3 * p1 - 3 * p2 + p3;
+    double b = 2 * (p0 - 2 * p1 + p2);
+    double c = p1 - p0;
+    int count = 0;
+
+    if (std::abs(a) < 1e-12) {
+        if (std::abs(b) > 1e-12) {
+            double t = -c / b;
+            if (t > 0 && t < 1) roots[count++] = t;
+        }
+        return count;
+    }
+
+    double disc = b * b - 4 * a * c;
+    if (disc < 0)
+        return 0;
+
+    double sq = std::sqrt(disc);
+    double t1 = (-b + sq) / (2 * a);
+    double t2 = (-b - sq) / (2 * a);
+    if (t1 > 0 && t1 < 1) roots[count++] = t1;
+    if (t2 > 0 && t2 < 1) roots[count++] = t2;
+    return count;
+}
+
+} // anonymous namespace
+
+GraphicPathGeometryPtr
+GraphicPathGeometry::create(Context& context, const std::string& pathData)
+{
+    // The cache is bounded, so animated path data does not accumulate
+    auto& cache = context.pathGeometries();
+    if (cache.has(pathData))
+        return cache.get(pathData);
+
+    auto ptr = create(pathData);
+    cache.put(pathData, ptr);
+    return ptr;
+}
+
+GraphicPathGeometryPtr
+GraphicPathGeometry::create(const std::string& pathData)
+{
+    return std::make_shared<GraphicPathGeometry>(pathData);
+}
+
+GraphicPathGeometry::GraphicPathGeometry(const std::string& pathData)
+{
+    PathParser parser(pathData, mCommands, mPoints);
+    if (!parser.parse())
+        LOG(LogLevel::kWarn) << "Malformed path data '" << pathData << "'";
+
+    // A trailing move draws nothing; drop it so that it doesn't affect the bounds
+    while (!mCommands.empty() && mCommands.back() == kGraphicPathCommandMoveTo) {
+        mCommands.pop_back();
+        mPoints.resize(mPoints.size() - 2);
+    }
+
+    calculateMetrics();
+}
+
+void
+GraphicPathGeometry::calculateMetrics()
+{
+    BoundsAccumulator bounds;
+    double length = 0;
+    double x = 0, y = 0;
+    double startX = 0, startY = 0;
+    const float *p = mPoints.data();
+
+    for (auto command : mCommands) {
+        switch (command) {
+            case kGraphicPathCommandMoveTo:
+                x = startX = p[0];
+                y = startY = p[1];
+                bounds.add(x, y);
+                p += 2;
+                break;
+
+            case kGraphicPathCommandLineTo:
+                length += std::hypot(p[0] - x, p[1] - y);
+                x = p[0];
+                y = p[1];
+                bounds.add(x, y);
+                p += 2;
+                break;
+
+            case kGraphicPathCommandQuadTo: {
+                // Elevate to a cubic so that we can share the extrema and length calculations
+                double c1x = x + 2.0 / 3.0 * (p[0] - x);
+                double c1y = y + 2.0 / 3.0 * (p[1] - y);
+                double c2x = p[2] + 2.0 / 3.0 * (p[0] - p[2]);
+                double c2y = p[3] + 2.0 / 3.0 * (p[1] - p[3]);
+                double roots[2];
+                int n = cubicExtrema(x, c1x, c2x, p[2], roots);
+                for (int i = 0; i < n; i++)
+                    bounds.add(quadAt(x, p[0], p[2], roots[i]), quadAt(y, p[1], p[3], roots[i]));
+                n = cubicExtrema(y, c1y, c2y, p[3], roots);
+                for (int i = 0; i < n; i++)
+                    bounds.add(quadAt(x, p[0], p[2], roots[i]), quadAt(y, p[1], p[3], roots[i]));
+
+                double lastX = x, lastY = y;
+                for (int i = 1; i <= CURVE_LENGTH_SEGMENTS; i++) {
+                    double t = static_cast<double>(i) / CURVE_LENGTH_SEGMENTS;
+                    double qx = quadAt(x, p[0], p[2], t);
+                    double qy = quadAt(y, p[1], p[3], t);
+                    length += std::hypot(qx - lastX, qy - lastY);
+                    lastX = qx;
+                    lastY = qy;
+                }
+
+                x = p[2];
+                y = p[3];
+                bounds.add(x, y);
+                p += 4;
+                break;
+            }
+
+            case kGraphicPathCommandCubicTo: {
+                double roots[2];
+                int n = cubicExtrema(x, p[0], p[2], p[4], roots);
+                for (int i = 0; i < n; i++)
+                    bounds.add(cubicAt(x, p[0], p[2], p[4], roots[i]), cubicAt(y, p[1], p[3], p[5], roots[i]));
+                n = cubicExtrema(y, p[1], p[3], p[5], roots);
+                for (int i = 0; i < n; i++)
+                    bounds.add(cubicAt(x, p[0], p[2], p[4], roots[i]), cubicAt(y, p[1], p[3], p[5], roots[i]));
+
+                double lastX = x, lastY = y;
+                for (int i = 1; i <= CURVE_LENGTH_SEGMENTS; i++) {
+                    double t = static_cast<double>(i) / CURVE_LENGTH_SEGMENTS;
+                    double cx = cubicAt(x, p[0], p[2], p[4], t);
+                    double cy = cubicAt(y, p[1], p[3], p[5], t);
+                    length += std::hypot(cx - lastX, cy - lastY);
+                    lastX = cx;
+                    lastY = cy;
+                }
+
+                x = p[4];
+                y = p[5];
+                bounds.add(x, y);
+                p += 6;
+                break;
+            }
+
+            case kGraphicPathCommandClose:
+                length += std::hypot(startX - x, startY - y);
+                x = startX;
+                y = startY;
+                break;
+        }
+    }
+
+    mBounds = bounds.rect();
+    mLength = static_cast<float>(length);
+}
+
+std::string
+GraphicPathGeometry::toDebugString() const
+{
+    return "GraphicPathGeometry<commands=" + std::to_string(mCommands.size()) +
+           " length=" + std::to_string(mLength) + " bounds=" + mBounds.toDebugString() + ">";
+}
+
+} // namespace apl
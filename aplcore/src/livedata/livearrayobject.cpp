@@ -13,6 +13,8 @@
  * permissions and limitations under the License.
  */
 
+#include <algorithm>
+
 #include "apl/livedata/livearrayobject.h"
 #include "apl/livedata/livearray.h"
 #include "apl/livedata/livearraychange.h"
@@ -69,6 +71,49 @@ LiveArrayObject::accept(Visitor<Object>& visitor) const
     visitor.pop();
 }
 
+/**
+ * Fold a new change into the previous change when the combined change maps new indices to old
+ * indices exactly as the two separate changes would (see newToOld).  Only changes of the same
+ * type that touch or overlap are merged.
+ * @param previous The most recent change.  This is modified in place when the changes merge.
+ * @param change The new change.
+ * @return True if the new change was merged.
+ */
+static bool
+coalesce(LiveArrayChange& previous, const LiveArrayChange& change)
+{
+    if (previous.command() != change.command())
+        return false;
+
+    auto p = previous.position();
+    auto c = previous.count();
+    auto q = change.position();
+    auto d = change.count();
+
+    switch (change.command()) {
+        case LiveArrayChange::INSERT:
+            // Inserting inside or at either end of the previous insertion
+            if (q < p || q > p + c)
+                return false;
+            previous = LiveArrayChange::insert(p, c + d);
+            return true;
+        case LiveArrayChange::REMOVE:
+            // Removing a range that ends at or straddles the previous removal point
+            if (q > p || q + d < p)
+                return false;
+            previous = LiveArrayChange::remove(q, c + d);
+            return true;
+        case LiveArrayChange::UPDATE:
+            // Overlapping or touching update ranges
+            if (q > p + c || q + d < p)
+                return false;
+            previous = LiveArrayChange::update(std::min(p, q), std::max(p + c, q + d) - std::min(p, q));
+            return true;
+        default:
+            return false;
+    }
+}
+
 void
 LiveArrayObject::handleArrayMessage(const LiveArrayChange& change)
 {
@@ -80,7 +125,7 @@ LiveArrayObject::handleArrayMessage(const LiveArrayChange& change)
         mReplaced = true;
         mChanges.clear();
     }
-    else {
+    else if (mChanges.empty() || !coalesce(mChanges.back(), change)) {
         mChanges.push_back(change);
     }
 
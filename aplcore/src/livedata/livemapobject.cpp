@@ -76,6 +76,7 @@ LiveMapObject::flush() {
     LiveDataObject::flush();
     mChanges.clear();
     mChanged.clear();
+    mPendingSets.clear();
 }
 
 const std::vector<LiveMapChange>&
@@ -112,8 +113,18 @@ LiveMapObject::handleMapMessage(const LiveMapChange& change)
     if (change.command() == LiveMapChange::REPLACE) {
         mReplaced = true;
         mChanges.clear();
+        mPendingSets.clear();
     }
     else {
+        // A SET is superseded by an earlier SET of the same key that has not been flushed yet;
+        // the current value is always read from the map, so only one entry is needed.
+        if (change.command() == LiveMapChange::SET) {
+            if (!mPendingSets.emplace(change.key()).second)
+                return;
+        }
+        else {
+            mPendingSets.erase(change.key());
+        }
         mChanges.push_back(change);
     }
 
@@ -13,8 +13,11 @@
  * permissions and limitations under the License.
  */
 
-#include <forward_list>
+#include <algorithm>
+#include <limits>
 
+#include "apl/component/component.h"
+#include "apl/content/rootconfig.h"
 #include "apl/engine/context.h"
 #include "apl/media/coremediamanager.h"
 #include "apl/media/mediaobject.h"
@@ -79,22 +82,70 @@ private:
 
 // ********************** CoreMediaManager implementation ********************
 
+/**
+ * @return The distance from the viewport to the closest of the components, or infinity if they are all gone.
+ *         Components in the viewport are at distance zero.
+ */
+static float
+distanceFromViewport(const Rect& viewport, const std::vector<std::weak_ptr<Component>>& components)
+{
+    auto result = std::numeric_limits<float>::infinity();
+    for (const auto& m : components) {
+        auto component = m.lock();
+        if (!component)
+            continue;
+
+        // Global bounds include the scroll offsets of any scrollable ancestors
+        auto bounds = component->getGlobalBounds();
+        auto dx = std::max(0.0f, std::max(viewport.getLeft() - bounds.getRight(), bounds.getLeft() - viewport.getRight()));
+        auto dy = std::max(0.0f, std::max(viewport.getTop() - bounds.getBottom(), bounds.getTop() - viewport.getBottom()));
+        result = std::min(result, dx + dy);
+    }
+    return result;
+}
+
 MediaObjectPtr
 CoreMediaManager::request(const std::string& url, EventMediaType type)
+{
+    return request(url, type, nullptr);
+}
+
+MediaObjectPtr
+CoreMediaManager::request(const std::string& url, EventMediaType type, const ComponentPtr& component)
 {
     // Check if the URL is in our loaded map
     auto it = mObjectMap.find(url);
     if (it != mObjectMap.end()) {
         auto ptr = it->second.lock();
-        if (ptr)
+        if (ptr) {
+            // A request that has not been sent yet is prioritized by every component that needs it
+            auto pending = mPending.find(url);
+            if (component && pending != mPending.end())
+                pending->second.components.emplace_back(component);
             return ptr;
+        }
         mObjectMap.erase(it);
     }
 
-    // Unrecognized URL; create a new media object and add it to the pending pool
+    // Unrecognized URL; create a new media object
     auto ptr = std::make_shared<CoreMediaObject>(url, type, shared_from_this());
     mObjectMap.emplace(url, ptr);
-    mPending.emplace(ptr);
+
+    // A cancelled request that has not been reported yet is still loading, so it doesn't need to be sent again
+    auto cancelled = mCancelled.find(url);
+    if (cancelled != mCancelled.end()) {
+        mInFlight.emplace(url, cancelled->second);
+        mCancelled.erase(cancelled);
+        return ptr;
+    }
+
+    // Add it to the pending pool
+    auto& pending = mPending[url];
+    pending.object = ptr;
+    pending.components.clear();
+    if (component)
+        pending.components.emplace_back(component);
+    pending.order = mRequestOrder++;
 
     return ptr;
 }
@@ -102,9 +153,49 @@ CoreMediaManager::request(const std::string& url, EventMediaType type)
 void
 CoreMediaManager::processMediaRequests(const ContextPtr& context)
 {
+    sendCancellations(context);
+
     if (mPending.empty())
         return;
 
+    // Sort the live requests by distance from the viewport, then by the order they were made
+    struct Candidate {
+        MediaObjectPtr object;
+        float distance;
+        size_t order;
+    };
+
+    Rect viewport(0, 0, context->width(), context->height());
+    std::vector<Candidate> candidates;
+    for (auto it = mPending.begin(); it != mPending.end();) {
+        auto ptr = it->second.object.lock();
+        if (ptr) {
+            candidates.emplace_back(Candidate{ptr, distanceFromViewport(viewport, it->second.components), it->second.order});
+            it++;
+        }
+        else {
+            it = mPending.erase(it);
+        }
+    }
+
+    std::sort(candidates.begin(), candidates.end(), [](const Candidate& a, const Candidate& b) {
+        return a.distance < b.distance || (a.distance == b.distance && a.order < b.order);
+    });
+
+    // Requests beyond the in-flight limit stay pending until earlier requests finish
+    auto limit = static_cast<size_t>(context->getRootConfig().getProperty(RootProperty::kMaxMediaRequestsInFlight).getInteger());
+    if (limit > 0) {
+        auto available = limit > mInFlight.size() ? limit - mInFlight.size() : 0;
+        if (candidates.size() > available)
+            candidates.resize(available);
+    }
+
+    for (const auto& m : candidates) {
+        mPending.erase(m.object->url());
+        if (limit > 0)
+            mInFlight.emplace(m.object->url(), m.object->type());
+    }
+
     // Note: We run these in enumerated order to simplify unit tests
     // that expect events to be generated in this order
     static std::vector<EventMediaType> sRequestTypes = {
@@ -116,10 +207,9 @@ CoreMediaManager::processMediaRequests(const ContextPtr& context)
     // This could be done more efficiently, but it should be replaced with a single request in the future.
     for (const auto& type : sRequestTypes) {
         auto sources = std::make_shared<ObjectArray>();
-        for (const auto& m : mPending) {
-            auto ptr = m.lock();
-            if (ptr && ptr->type() == type)
-                sources->emplace_back(ptr->url());
+        for (const auto& m : candidates) {
+            if (m.object->type() == type)
+                sources->emplace_back(m.object->url());
         }
 
         if (!sources->empty()) {
@@ -129,8 +219,29 @@ CoreMediaManager::processMediaRequests(const ContextPtr& context)
             context->pushEvent(Event(kEventTypeMediaRequest, std::move(bag)));
         }
     }
+}
 
-    mPending.clear();
+void
+CoreMediaManager::sendCancellations(const ContextPtr& context)
+{
+    if (mCancelled.empty())
+        return;
+
+    std::map<EventMediaType, std::shared_ptr<ObjectArray>> sourcesByType;
+    for (const auto& m : mCancelled) {
+        auto& sources = sourcesByType[m.second];
+        if (!sources)
+            sources = std::make_shared<ObjectArray>();
+        sources->emplace_back(m.first);
+    }
+    mCancelled.clear();
+
+    for (const auto& m : sourcesByType) {
+        EventBag bag;
+        bag.emplace(kEventPropertySource, m.second);
+        bag.emplace(kEventPropertyMediaType, m.first);
+        context->pushEvent(Event(kEventTypeMediaCancel, std::move(bag)));
+    }
 }
 
 void
@@ -140,6 +251,9 @@ CoreMediaManager::mediaLoadComplete(
     int errorCode,
     const std::string& errorReason)
 {
+    mInFlight.erase(source);
+    mCancelled.erase(source);
+
     auto it = mObjectMap.find(source);
     if (it == mObjectMap.end())
         return;
@@ -173,6 +287,13 @@ CoreMediaManager::removeMediaObject(const std::string& url)
     if (it != mObjectMap.end())
         mObjectMap.erase(it);
 
+    // A request that is still loading is cancelled in the next processMediaRequests call
+    auto inFlight = mInFlight.find(url);
+    if (inFlight != mInFlight.end()) {
+        mCancelled.emplace(url, inFlight->second);
+        mInFlight.erase(inFlight);
+    }
+
     // Don't bother to scan the pending set; it will automatically be cleared in the next processMediaRequests call
 }
 
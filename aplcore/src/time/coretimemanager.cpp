@@ -14,7 +14,6 @@
  */
 
 #include <algorithm>
-#include <iterator>
 
 #include "apl/time/coretimemanager.h"
 #include "apl/utils/log.h"
@@ -28,10 +27,11 @@ CoreTimeManager::setTimeout(Runnable func, apl_duration_t delay)
 {
     LOG_IF(DEBUG_CORE_TIME) << "id=" << mNextId << " delay=" << delay;
 
-    timeout_id id = mNextId++;
-    mTimerHeap.emplace_back(TimeoutTuple(func, nullptr, mTime, delay, id));
-    std::push_heap(mTimerHeap.begin(), mTimerHeap.end());
-    return id;
+    auto index = allocateSlot(mTime, delay);
+    auto& slot = mSlots[index];
+    slot.runnable = std::move(func);
+    schedule(index);
+    return slot.id;
 }
 
 timeout_id
@@ -39,11 +39,37 @@ CoreTimeManager::setAnimator(Animator animator, apl_duration_t delay)
 {
     LOG_IF(DEBUG_CORE_TIME) << "id=" << mNextId << " delay=" << delay;
 
-    timeout_id id = mNextId++;
-    mTimerHeap.emplace_back(TimeoutTuple(nullptr, animator, mTime, delay, id));
-    std::push_heap(mTimerHeap.begin(), mTimerHeap.end());
+    auto index = allocateSlot(mTime, delay);
+    auto& slot = mSlots[index];
+    slot.animator = std::move(animator);
+    slot.pass = mAnimatorPass;
+
+    slot.prevAnimator = mAnimatorTail;
+    if (mAnimatorTail != NO_SLOT)
+        mSlots[mAnimatorTail].nextAnimator = index;
+    else
+        mAnimatorHead = index;
+    mAnimatorTail = index;
     mAnimatorCount++;
-    return id;
+
+    schedule(index);
+    return slot.id;
+}
+
+timeout_id
+CoreTimeManager::setInterval(Ticker ticker, apl_duration_t interval)
+{
+    LOG_IF(DEBUG_CORE_TIME) << "id=" << mNextId << " interval=" << interval;
+
+    // A zero interval would fire forever without time advancing
+    interval = std::max(interval, static_cast<apl_duration_t>(1));
+
+    auto index = allocateSlot(mTime, interval);
+    auto& slot = mSlots[index];
+    slot.ticker = std::move(ticker);
+    slot.interval = interval;
+    schedule(index);
+    return slot.id;
 }
 
 bool
@@ -51,17 +77,13 @@ CoreTimeManager::clearTimeout(timeout_id id)
 {
     LOG_IF(DEBUG_CORE_TIME) << "id=" << id;
 
-    for (auto it = mTimerHeap.begin(); it != mTimerHeap.end(); it++) {
-        if (it->id == id) {
-            if (it->animator)
-                mAnimatorCount--;
-            it = mTimerHeap.erase(it);
-            std::make_heap(mTimerHeap.begin(), mTimerHeap.end());
-            return true;
-        }
-    }
+    auto it = mSlotById.find(id);
+    if (it == mSlotById.end())
+        return false;
 
-    return false;
+    releaseSlot(it->second);
+    removeFromHeap(id);
+    return true;
 }
 
 void
@@ -80,21 +102,29 @@ CoreTimeManager::updateTime(apl_time_t updatedTime)
         return;
     }
 
-    while (!mTimerHeap.empty() && mTimerHeap.begin()->endTime <= updatedTime)
+    while (!mTimerHeap.empty() && mTimerHeap.front().endTime <= updatedTime)
         advanceToNext();
 
     mTime = updatedTime;
 
-    // Collect active (i.e. not completed) animators
-    std::vector<TimeoutTuple> animators;
-    animators.reserve(mAnimatorCount);
-    std::copy_if(mTimerHeap.begin(), mTimerHeap.end(), std::back_inserter(animators),
-                 [](TimeoutTuple m) { return m.animator; });
+    // Run the active animators in place, including any started by a timer in this update.  Animators
+    // started by another animator sit at the end of the list and first run on the next update.  The
+    // cursor is advanced by releaseSlot() if an animator removes the one that follows it.
+    auto pass = ++mAnimatorPass;
+    auto savedCursor = mAnimatorCursor;
+    for (auto index = mAnimatorHead; index != NO_SLOT; index = mAnimatorCursor) {
+        auto& slot = mSlots[index];
+        if (slot.pass == pass)
+            break;
 
-    // Run animators outside timer heap iteration since running animators can mutate the heap
-    for (auto &m : animators) {
-        m.animator(mTime - m.startTime);
+        mAnimatorCursor = slot.nextAnimator;
+        slot.running = true;
+        slot.animator(mTime - slot.startTime);
+        slot.running = false;
+        if (slot.id == 0)
+            recycleSlot(index);
     }
+    mAnimatorCursor = savedCursor;
 }
 
 apl_time_t
@@ -103,8 +133,8 @@ CoreTimeManager::nextTimeout()
     if (mAnimatorCount > 0)
         return mTime + 1;
 
-    if (mTimerHeap.size())
-        return mTimerHeap.at(0).endTime;
+    if (!mTimerHeap.empty())
+        return mTimerHeap.front().endTime;
 
     return std::numeric_limits<apl_time_t>::max();
 }
@@ -112,14 +142,24 @@ CoreTimeManager::nextTimeout()
 void
 CoreTimeManager::runPending()
 {
-    while (mTimerHeap.size() && mTimerHeap.begin()->endTime <= mTime)
+    while (!mTimerHeap.empty() && mTimerHeap.front().endTime <= mTime)
         advanceToNext();
 }
 
 void
 CoreTimeManager::clear()
 {
+    for (size_t index = 0; index < mSlots.size(); index++)
+        if (mSlots[index].id != 0)
+            releaseSlot(index);
+
     mTimerHeap.clear();
+
+    // Give back the storage unless a callback is still executing
+    if (mFreeSlots.size() == mSlots.size()) {
+        mSlots.clear();
+        mFreeSlots.clear();
+    }
 }
 
 void
@@ -135,24 +175,141 @@ CoreTimeManager::isTerminated()
     return mTerminated;
 }
 
-void CoreTimeManager::advanceToNext()
+void
+CoreTimeManager::advanceToNext()
 {
     std::pop_heap(mTimerHeap.begin(), mTimerHeap.end());  // Move to end
-    TimeoutTuple tt = mTimerHeap.back();  // Grab the last element
+    auto entry = mTimerHeap.back();  // Grab the last element
     mTimerHeap.pop_back();  // Remove the last element
-    mTime = tt.endTime;   // Advance the clock
-    if (tt.runnable) {
+
+    // Slots live in a deque, so this reference survives timers created by the callback
+    auto& slot = mSlots[entry.slot];
+    mTime = slot.endTime;   // Advance the clock
+
+    if (slot.ticker) {
+        LOG_IF(DEBUG_CORE_TIME) << "Executing the ticker";
+        slot.running = true;
+        bool keepRunning = slot.ticker();
+        slot.running = false;
+
+        if (slot.id != entry.id)
+            recycleSlot(entry.slot);   // Cancelled by the ticker
+        else if (!keepRunning || mTerminated)
+            releaseSlot(entry.slot);
+        else {
+            // Re-arm the same slot; the id stays valid for clearTimeout()
+            slot.startTime = slot.endTime;
+            slot.endTime += slot.interval;
+            schedule(entry.slot);
+        }
+    }
+    else if (slot.runnable) {
         LOG_IF(DEBUG_CORE_TIME) << "Executing the runnable";
-        tt.runnable();  // Execute the runnable
+        auto runnable = std::move(slot.runnable);
+        releaseSlot(entry.slot);
+        runnable();  // Execute the runnable
     }
-    else if (tt.animator) {
+    else if (slot.animator) {
         LOG_IF(DEBUG_CORE_TIME) << "Executing the animator";
-        tt.animator(tt.endTime - tt.startTime);
-        mAnimatorCount--;
+        slot.running = true;
+        slot.animator(slot.endTime - slot.startTime);
+        slot.running = false;
+
+        if (slot.id != entry.id)
+            recycleSlot(entry.slot);
+        else
+            releaseSlot(entry.slot);
     }
     else {
         LOG(LogLevel::kError) << "No animator or runnable defined";
+        releaseSlot(entry.slot);
+    }
+}
+
+size_t
+CoreTimeManager::allocateSlot(apl_time_t startTime, apl_duration_t duration)
+{
+    size_t index;
+    if (!mFreeSlots.empty()) {
+        index = mFreeSlots.back();
+        mFreeSlots.pop_back();
+    }
+    else {
+        index = mSlots.size();
+        mSlots.emplace_back();
     }
+
+    auto& slot = mSlots[index];
+    slot.startTime = startTime;
+    slot.endTime = startTime + duration;
+    slot.id = mNextId++;
+    mSlotById.emplace(slot.id, index);
+    return index;
+}
+
+void
+CoreTimeManager::schedule(size_t index)
+{
+    const auto& slot = mSlots[index];
+    mTimerHeap.emplace_back(HeapEntry{slot.endTime, index, slot.id});
+    std::push_heap(mTimerHeap.begin(), mTimerHeap.end());
+}
+
+void
+CoreTimeManager::releaseSlot(size_t index)
+{
+    auto& slot = mSlots[index];
+    if (slot.id == 0)
+        return;
+
+    mSlotById.erase(slot.id);
+    slot.id = 0;
+
+    if (slot.animator) {
+        if (mAnimatorCursor == index)
+            mAnimatorCursor = slot.nextAnimator;
+
+        if (slot.prevAnimator != NO_SLOT)
+            mSlots[slot.prevAnimator].nextAnimator = slot.nextAnimator;
+        else
+            mAnimatorHead = slot.nextAnimator;
+
+        if (slot.nextAnimator != NO_SLOT)
+            mSlots[slot.nextAnimator].prevAnimator = slot.prevAnimator;
+        else
+            mAnimatorTail = slot.prevAnimator;
+
+        mAnimatorCount--;
+    }
+
+    // An executing callback can't be destroyed; the caller recycles the slot when it returns
+    if (!slot.running)
+        recycleSlot(index);
+}
+
+void
+CoreTimeManager::recycleSlot(size_t index)
+{
+    auto& slot = mSlots[index];
+    slot.runnable = nullptr;
+    slot.animator = nullptr;
+    slot.ticker = nullptr;
+    slot.interval = 0;
+    slot.prevAnimator = NO_SLOT;
+    slot.nextAnimator = NO_SLOT;
+    mFreeSlots.emplace_back(index);
+}
+
+void
+CoreTimeManager::removeFromHeap(timeout_id id)
+{
+    auto it = std::find_if(mTimerHeap.begin(), mTimerHeap.end(),
+                           [id](const HeapEntry& entry) { return entry.id == id; });
+    if (it == mTimerHeap.end())
+        return;   // Already popped; the callback is running
+
+    mTimerHeap.erase(it);
+    std::make_heap(mTimerHeap.begin(), mTimerHeap.end());
 }
 
 } // namespace apl
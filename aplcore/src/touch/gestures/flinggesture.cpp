@@ -51,6 +51,12 @@ FlingGesture::onMove(const PointerEvent& event, apl_time_t timestamp)
     return true;
 }
 
+void
+FlingGesture::onTrackMove(const PointerEvent& event, apl_time_t timestamp)
+{
+    mVelocityTracker->addPointerEvent(event, timestamp);
+}
+
 bool
 FlingGesture::onDown(const PointerEvent& event, apl_time_t timestamp)
 {
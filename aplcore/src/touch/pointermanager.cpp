@@ -184,6 +184,56 @@ PointerManager::handlePointerEvent(const PointerEvent& pointerEvent, apl_time_t
     return pointer->isCaptured();
 }
 
+bool
+PointerManager::handlePointerEvents(const std::vector<PointerSample>& samples, apl_time_t currentTime)
+{
+    bool consumed = false;
+
+    auto it = samples.begin();
+    while (it != samples.end()) {
+        const auto& event = it->event;
+        auto last = it;
+        if (event.pointerEventType == kPointerMove) {
+            // Find the end of this run of moves from the same pointer
+            while (last + 1 != samples.end() &&
+                   (last + 1)->event.pointerEventType == kPointerMove &&
+                   (last + 1)->event.pointerId == event.pointerId &&
+                   (last + 1)->event.pointerType == event.pointerType)
+                last++;
+
+            for (; it != last; it++)
+                trackPointerMove(it->event, std::min(it->timestamp, currentTime));
+        }
+
+        if (handlePointerEvent(last->event, std::min(last->timestamp, currentTime)))
+            consumed = true;
+        it = last + 1;
+    }
+
+    return consumed;
+}
+
+void
+PointerManager::trackPointerMove(const PointerEvent& pointerEvent, apl_time_t timestamp)
+{
+    // Only active pointers have a target; hover updates are simply replaced by the final move
+    if (!mActivePointer || pointerEvent.pointerId != mActivePointer->getId())
+        return;
+
+    auto target = mActivePointer->getTarget();
+    if (!target)
+        return;
+
+    if (mActivePointer->isCaptured()) {
+        target->trackPointerMove(pointerEvent, timestamp);
+        return;
+    }
+
+    auto hitListIt = HitListIterator(target);
+    while (auto hitTarget = hitListIt.next())
+        hitTarget->trackPointerMove(pointerEvent, timestamp);
+}
+
 void
 PointerManager::handleTimeUpdate(apl_time_t timestamp)
 {
@@ -0,0 +1,96 @@
+/**
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#include "apl/utils/workerpool.h"
+
+namespace apl {
+
+WorkerPool::WorkerPool(size_t threads)
+    : mStride(threads + 1)
+{
+    mThreads.reserve(threads);
+    for (size_t i = 0; i < threads; i++)
+        mThreads.emplace_back(&WorkerPool::work, this, i);
+}
+
+WorkerPool::~WorkerPool()
+{
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+        mStop = true;
+    }
+    mStart.notify_all();
+
+    for (auto& thread : mThreads)
+        thread.join();
+}
+
+void
+WorkerPool::run(size_t count, const Task& task)
+{
+    // Nothing to share with the workers
+    auto stride = count > 1 ? mStride : 1;
+
+    if (stride > 1) {
+        {
+            std::lock_guard<std::mutex> lock(mMutex);
+            mTask = &task;
+            mCount = count;
+            mRunning = mThreads.size();
+            mBatch++;
+        }
+        mStart.notify_all();
+    }
+
+    for (size_t i = 0; i < count; i += stride)
+        task(i);
+
+    if (stride > 1) {
+        std::unique_lock<std::mutex> lock(mMutex);
+        mDone.wait(lock, [this] { return mRunning == 0; });
+        mTask = nullptr;
+    }
+}
+
+void
+WorkerPool::work(size_t worker)
+{
+    size_t batch = 0;
+
+    for (;;) {
+        const Task *task;
+        size_t count;
+        {
+            std::unique_lock<std::mutex> lock(mMutex);
+            mStart.wait(lock, [&] { return mStop || mBatch != batch; });
+            if (mStop)
+                return;
+            batch = mBatch;
+            task = mTask;
+            count = mCount;
+        }
+
+        for (size_t i = worker + 1; i < count; i += mStride)
+            (*task)(i);
+
+        {
+            std::lock_guard<std::mutex> lock(mMutex);
+            mRunning--;
+        }
+        mDone.notify_one();
+    }
+}
+
+} // namespace apl
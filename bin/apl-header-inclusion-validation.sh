@@ -74,6 +74,7 @@ public_apl_headers=(
     "apl/graphic/graphiccontent.h"
     "apl/graphic/graphicfilter.h"
     "apl/graphic/graphicelement.h"
+    "apl/graphic/graphicpathgeometry.h"
     "apl/graphic/graphicpattern.h"
     "apl/graphic/graphicproperties.h"
     "apl/livedata/livearray.h"
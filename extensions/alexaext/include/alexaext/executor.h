@@ -40,6 +40,12 @@ public:
      */
     virtual bool enqueueTask(Task task) = 0;
 
+    /**
+     * @return @c true if every task is executed before enqueueTask returns. Callers may then pass data to the task by
+     *         reference instead of copying it.
+     */
+    virtual bool isSynchronous() const { return false; }
+
     /**
      * @return A shared instance of a synchronous executor.
      */
@@ -0,0 +1,227 @@
+/**
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#include "../testeventloop.h"
+
+#include "apl/command/commandtemplate.h"
+
+using namespace apl;
+
+class CommandTemplateTest : public DocumentWrapper {};
+
+static const char *REPEATED_PRESS = R"apl(
+    {
+      "type": "APL",
+      "version": "1.7",
+      "commands": {
+        "Bump": {
+          "parameters": [ "by" ],
+          "command": {
+            "type": "SetValue",
+            "componentId": "MyText",
+            "property": "text",
+            "value": "${by * 2}"
+          }
+        }
+      },
+      "mainTemplate": {
+        "items": {
+          "type": "TouchWrapper",
+          "bind": { "name": "TheCount", "value": 0 },
+          "width": 100,
+          "height": 100,
+          "onPress": [
+            {
+              "type": "SetValue",
+              "property": "TheCount",
+              "value": "${TheCount + 1}"
+            },
+            {
+              "type": "SetValue",
+              "when": "${TheCount > 2}",
+              "componentId": "MyText",
+              "property": "text",
+              "value": "Big ${TheCount}"
+            },
+            {
+              "type": "Sequential",
+              "when": false,
+              "commands": { "type": "SendEvent" }
+            }
+          ],
+          "items": {
+            "type": "Text",
+            "id": "MyText",
+            "text": "Start"
+          }
+        }
+      }
+    }
+)apl";
+
+#ifdef DEBUG_MEMORY_USE
+/**
+ * @return The number of command templates compiled so far.
+ */
+static CounterPair::size_type
+compiledTemplates()
+{
+    return Counter<CommandTemplate>::itemsDelta().created;
+}
+#endif
+
+TEST_F(CommandTemplateTest, RepeatedPress)
+{
+    loadDocument(REPEATED_PRESS);
+    auto text = root->findComponentById("MyText");
+    ASSERT_TRUE(text);
+
+#ifdef DEBUG_MEMORY_USE
+    auto compiled = compiledTemplates();
+#endif
+
+    performClick(1, 1);
+    root->clearPending();
+    ASSERT_EQ("Start", text->getCalculated(kPropertyText).asString());
+
+#ifdef DEBUG_MEMORY_USE
+    // The first press compiles one template per command
+    ASSERT_EQ(compiled + 3, compiledTemplates());
+#endif
+
+    // Later presses reuse them, but still evaluate the data-bound properties and "when" clauses
+    performClick(1, 1);
+    root->clearPending();
+    ASSERT_EQ("Start", text->getCalculated(kPropertyText).asString());
+    performClick(1, 1);
+    root->clearPending();
+    ASSERT_EQ("Big 3", text->getCalculated(kPropertyText).asString());
+    ASSERT_FALSE(root->hasEvent());
+
+#ifdef DEBUG_MEMORY_USE
+    ASSERT_EQ(compiled + 3, compiledTemplates());
+#endif
+}
+
+TEST_F(CommandTemplateTest, Macro)
+{
+    loadDocument(REPEATED_PRESS);
+    auto text = root->findComponentById("MyText");
+
+    executeCommand("Bump", {{"by", 10}}, false);
+    ASSERT_EQ("20", text->getCalculated(kPropertyText).asString());
+
+#ifdef DEBUG_MEMORY_USE
+    auto compiled = compiledTemplates();
+#endif
+
+    executeCommand("Bump", {{"by", 20}}, false);
+    ASSERT_EQ("40", text->getCalculated(kPropertyText).asString());
+
+#ifdef DEBUG_MEMORY_USE
+    // The harness builds each outer command in fresh JSON, so only the macro body is reused
+    ASSERT_EQ(compiled + 1, compiledTemplates());
+#endif
+}
+
+TEST_F(CommandTemplateTest, ReplacedJson)
+{
+    loadDocument(REPEATED_PRESS);
+    auto text = root->findComponentById("MyText");
+    auto& templates = context->commandTemplates();
+
+    rapidjson::Document doc;
+    doc.Parse(R"([{"type": "SetValue", "componentId": "MyText", "property": "text", "value": "One"}])");
+
+    root->executeCommands(doc, false);
+    root->clearPending();
+    ASSERT_EQ("One", text->getCalculated(kPropertyText).asString());
+
+    // The same definition is reused
+    auto first = templates.get(doc[0]);
+    root->executeCommands(doc, false);
+    root->clearPending();
+    ASSERT_EQ(first, templates.get(doc[0]));
+
+    // A changed value at the same address is compiled again
+    doc[0]["value"].SetString("Two", doc.GetAllocator());
+    root->executeCommands(doc, false);
+    root->clearPending();
+    ASSERT_EQ("Two", text->getCalculated(kPropertyText).asString());
+    auto second = templates.get(doc[0]);
+    ASSERT_NE(first, second);
+    ASSERT_TRUE(second->matches(doc[0]));
+    ASSERT_FALSE(first->matches(doc[0]));
+}
+
+TEST_F(CommandTemplateTest, ConvertedProperties)
+{
+    loadDocument(REPEATED_PRESS);
+    auto text = root->findComponentById("MyText");
+
+    rapidjson::Document doc;
+    doc.Parse(R"([{"type": "SetValue", "componentId": "MyText", "property": "text", "value": "${1+2}"}])");
+    root->executeCommands(doc, false);
+    root->clearPending();
+    ASSERT_EQ("3", text->getCalculated(kPropertyText).asString());
+
+    // The static property name was converted once; the evaluated value is never stored
+    auto commandTemplate = context->commandTemplates().get(doc[0]);
+    Object converted;
+    ASSERT_TRUE(commandTemplate->getConverted(kCommandPropertyProperty, Object("text"), converted));
+    ASSERT_EQ(Object("text"), converted);
+    ASSERT_FALSE(commandTemplate->getConverted(kCommandPropertyProperty, Object("color"), converted));
+    ASSERT_FALSE(commandTemplate->getConverted(kCommandPropertyValue, Object("${1+2}"), converted));
+
+    // A data-bound property name may convert differently each time, so it is never stored
+    rapidjson::Document bound;
+    bound.Parse(R"([{"type": "SetValue", "componentId": "MyText", "property": "${'te' + 'xt'}", "value": "Five"}])");
+    root->executeCommands(bound, false);
+    root->clearPending();
+    ASSERT_EQ("Five", text->getCalculated(kPropertyText).asString());
+    commandTemplate = context->commandTemplates().get(bound[0]);
+    ASSERT_FALSE(commandTemplate->getConverted(kCommandPropertyProperty, Object("${'te' + 'xt'}"), converted));
+
+    // Commands built from a template with a data-bound type do not share conversions
+    doc.Parse(R"([{"type": "${'SetValue'}", "componentId": "MyText", "property": "text", "value": "Four"}])");
+    root->executeCommands(doc, false);
+    root->clearPending();
+    ASSERT_EQ("Four", text->getCalculated(kPropertyText).asString());
+    commandTemplate = context->commandTemplates().get(doc[0]);
+    ASSERT_FALSE(commandTemplate->getConverted(kCommandPropertyProperty, Object("text"), converted));
+}
+
+TEST_F(CommandTemplateTest, Properties)
+{
+    // Copies share storage until one is modified
+    Properties a;
+    a.emplace("x", 1);
+    a.emplace("y", 2);
+
+    Properties b;
+    b.emplace(a);
+    ASSERT_EQ(2, b.size());
+    b.emplace("z", 3);
+    ASSERT_EQ(3, b.size());
+    ASSERT_EQ(2, a.size());
+
+    // Existing values are not replaced
+    Properties c;
+    c.emplace("x", 10);
+    c.emplace(a);
+    ASSERT_EQ(2, c.size());
+    ASSERT_EQ(Object(10), c.find("x")->second);
+    ASSERT_EQ(Object(2), c.find("y")->second);
+}
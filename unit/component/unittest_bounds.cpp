@@ -19,6 +19,7 @@
 
 #include "apl/engine/evaluate.h"
 #include "apl/engine/builder.h"
+#include "apl/engine/layoutmanager.h"
 #include "apl/component/component.h"
 
 #include "../testeventloop.h"
@@ -493,3 +494,287 @@ TEST_F(BoundsTest, AbsolutePositioning)
     ASSERT_EQ(Rect(10, 40, 50, 50), text2->getCalculated(kPropertyBounds).getRect());
     ASSERT_EQ(Rect(810, 340, 50, 50), text2->getGlobalBounds());
 }
+
+static const char *UNCHANGED_SUBTREE = R"({
+  "type": "APL",
+  "version": "1.1",
+  "mainTemplate": {
+    "item": {
+      "type": "Container",
+      "width": 500,
+      "height": 500,
+      "items": [
+        {
+          "type": "Frame",
+          "width": 200,
+          "height": 200,
+          "item": {
+            "type": "Frame",
+            "id": "INNER",
+            "width": 10,
+            "height": 10
+          }
+        },
+        {
+          "type": "Container",
+          "width": 200,
+          "height": 200,
+          "items": {
+            "type": "Frame",
+            "width": 20,
+            "height": 20
+          },
+          "data": [1,2,3,4,5]
+        }
+      ]
+    }
+  }
+})";
+
+TEST_F(BoundsTest, UnchangedSubtree)
+{
+    loadDocument(UNCHANGED_SUBTREE);
+
+    auto& layoutManager = component->getContext()->layoutManager();
+    ASSERT_EQ(9, layoutManager.passStatistics().visited);
+
+    auto inner = root->findComponentById("INNER");
+    executeCommand("SetValue", {{"componentId", "INNER"}, {"property", "width"}, {"value", 50}}, true);
+    root->clearPending();
+
+    ASSERT_EQ(Rect(0, 0, 50, 10), inner->getCalculated(kPropertyBounds).getRect());
+
+    // The top, both of its children, and the resized Frame.  The cached Container children are skipped.
+    ASSERT_EQ(4, layoutManager.passStatistics().visited);
+    ASSERT_EQ(1, layoutManager.passStatistics().changed);
+
+    auto container = component->getCoreChildAt(1);
+    for (auto i = 0 ; i < container->getChildCount() ; i++)
+        ASSERT_EQ(Rect(0, 20*i, 20, 20), container->getCoreChildAt(i)->getCalculated(kPropertyBounds).getRect());
+}
+
+/**
+ * Check that the bounds of every attached component match its Yoga layout.  Sticky components
+ * are skipped because their bounds include the sticky offset.
+ */
+static ::testing::AssertionResult
+CheckLayoutProcessed(const CoreComponentPtr& component)
+{
+    if (component->getCalculated(kPropertyPosition) != kPositionSticky) {
+        auto node = component->getNode();
+        Rect yoga(YGNodeLayoutGetLeft(node), YGNodeLayoutGetTop(node),
+                  YGNodeLayoutGetWidth(node), YGNodeLayoutGetHeight(node));
+        auto bounds = component->getCalculated(kPropertyBounds).getRect();
+        if (yoga != bounds)
+            return ::testing::AssertionFailure() << component->toDebugSimpleString()
+                                                 << " bounds=" << bounds.toString()
+                                                 << " yoga=" << yoga.toString();
+    }
+
+    for (size_t i = 0; i < component->getChildCount(); i++) {
+        auto child = component->getCoreChildAt(i);
+        if (!child->isAttached())
+            continue;
+        auto result = CheckLayoutProcessed(child);
+        if (!result)
+            return result;
+    }
+
+    return ::testing::AssertionSuccess();
+}
+
+static std::string
+replaceAll(std::string doc, const std::string& from, const std::string& to)
+{
+    for (auto pos = doc.find(from); pos != std::string::npos; pos = doc.find(from, pos + to.size()))
+        doc.replace(pos, from.size(), to);
+    return doc;
+}
+
+static const char *FRACTIONAL_MOVE = R"({
+  "type": "APL",
+  "version": "1.1",
+  "mainTemplate": {
+    "item": {
+      "type": "Container",
+      "width": 500,
+      "height": 500,
+      "items": [
+        {
+          "type": "Frame",
+          "id": "SPACER",
+          "width": 100,
+          "height": SPACER_HEIGHT
+        },
+        {
+          "type": "Frame",
+          "width": 200,
+          "height": 200,
+          "item": {
+            "type": "Container",
+            "width": "100%",
+            "items": {
+              "type": "Frame",
+              "width": 20.3,
+              "height": 33.3,
+              "item": {
+                "type": "Frame",
+                "width": "50%",
+                "height": "50%"
+              }
+            },
+            "data": [1,2,3]
+          }
+        }
+      ]
+    }
+  }
+})";
+
+TEST_F(BoundsTest, UnchangedSubtreeRounding)
+{
+    // Rounding is applied to a grid of 2/3 dp
+    metrics.dpi(240);
+    auto doc = std::string(FRACTIONAL_MOVE);
+    loadDocument(replaceAll(doc, "SPACER_HEIGHT", "10").c_str());
+    ASSERT_TRUE(CheckLayoutProcessed(component));
+
+    // Move the cached Frame down by a fraction of a pixel a few times
+    for (auto height : {10.3, 10.6, 11.1, 10.4}) {
+        executeCommand("SetValue", {{"componentId", "SPACER"}, {"property", "height"}, {"value", height}}, true);
+        root->clearPending();
+        ASSERT_TRUE(CheckLayoutProcessed(component)) << height;
+    }
+
+    // Ten components in total; the contents of the cached Frame are not all processed again.  Yoga
+    // re-rounds cached nodes from their rounded sizes, so the bounds may not match a fresh layout,
+    // but they always match what Yoga reports.
+    ASSERT_LT(component->getContext()->layoutManager().passStatistics().visited, 10);
+}
+
+static const char *STICKY_IN_CACHED_SUBTREE = R"({
+  "type": "APL",
+  "version": "1.6",
+  "mainTemplate": {
+    "item": {
+      "type": "ScrollView",
+      "id": "SCROLL",
+      "width": 400,
+      "height": SCROLL_HEIGHT,
+      "item": {
+        "type": "Container",
+        "width": 400,
+        "height": 1000,
+        "items": [
+          {
+            "type": "Frame",
+            "width": 400,
+            "height": 100
+          },
+          {
+            "type": "Container",
+            "width": 400,
+            "height": 800,
+            "items": [
+              {
+                "type": "Frame",
+                "width": 400,
+                "height": 700
+              },
+              {
+                "type": "Frame",
+                "id": "STICKY",
+                "position": "sticky",
+                "bottom": 0,
+                "width": 100,
+                "height": 50
+              }
+            ]
+          }
+        ]
+      }
+    }
+  }
+})";
+
+TEST_F(BoundsTest, UnchangedSubtreeSticky)
+{
+    auto doc = std::string(STICKY_IN_CACHED_SUBTREE);
+    loadDocument(replaceAll(doc, "SCROLL_HEIGHT", "500").c_str());
+    auto before = root->findComponentById("STICKY")->getCalculated(kPropertyBounds).getRect();
+
+    // The content of the ScrollView has a fixed size, so Yoga does not lay out the sticky component again
+    executeCommand("SetValue", {{"componentId", "SCROLL"}, {"property", "height"}, {"value", 400}}, true);
+    root->clearPending();
+    ASSERT_TRUE(CheckLayoutProcessed(component));
+    auto after = root->findComponentById("STICKY")->getCalculated(kPropertyBounds).getRect();
+    ASSERT_NE(before, after);
+
+    loadDocument(replaceAll(doc, "SCROLL_HEIGHT", "400").c_str());
+    ASSERT_EQ(root->findComponentById("STICKY")->getCalculated(kPropertyBounds).getRect(), after);
+}
+
+static const char *NESTED_RELAYOUT = R"({
+  "type": "APL",
+  "version": "1.6",
+  "mainTemplate": {
+    "item": {
+      "type": "Container",
+      "width": 500,
+      "height": 500,
+      "items": [
+        {
+          "type": "Frame",
+          "id": "HEADER",
+          "width": 500,
+          "height": 50
+        },
+        {
+          "type": "Sequence",
+          "id": "SEQUENCE",
+          "width": 300,
+          "height": 200,
+          "items": {
+            "type": "Frame",
+            "width": "100%",
+            "height": 50,
+            "item": {
+              "type": "Text",
+              "text": "${data}"
+            }
+          },
+          "data": ["A", "BB", "CCC", "DDDD", "EEEEE", "FFFFFF", "GGGGGGG", "HHHHHHHH", "IIIIIIIII", "JJJJJJJJJJ",
+                   "A", "BB", "CCC", "DDDD", "EEEEE", "FFFFFF", "GGGGGGG", "HHHHHHHH", "IIIIIIIII", "JJJJJJJJJJ"]
+        }
+      ]
+    }
+  }
+})";
+
+TEST_F(BoundsTest, UnchangedSubtreeNestedRelayout)
+{
+    loadDocument(NESTED_RELAYOUT);
+    advanceTime(10);
+    ASSERT_TRUE(CheckLayoutProcessed(component));
+
+    // Scrolling lazily attaches more children, which lays out the whole tree again from inside
+    // processLayoutChanges()
+    auto sequence = std::static_pointer_cast<CoreComponent>(root->findComponentById("SEQUENCE"));
+    for (auto position : {100, 350, 700}) {
+        sequence->update(kUpdateScrollPosition, position);
+        root->clearPending();
+        advanceTime(10);
+        ASSERT_TRUE(CheckLayoutProcessed(component)) << position;
+    }
+
+    // Moving the Sequence keeps everything below it in place
+    executeCommand("SetValue", {{"componentId", "HEADER"}, {"property", "height"}, {"value", 80}}, true);
+    root->clearPending();
+    ASSERT_TRUE(CheckLayoutProcessed(component));
+    ASSERT_EQ(Rect(0, 80, 300, 200), sequence->getCalculated(kPropertyBounds).getRect());
+    for (size_t i = 0; i < sequence->getChildCount(); i++) {
+        auto child = sequence->getCoreChildAt(i);
+        if (child->isAttached())
+            ASSERT_EQ(Rect(0, 50 * i, 300, 50), child->getCalculated(kPropertyBounds).getRect()) << i;
+    }
+}
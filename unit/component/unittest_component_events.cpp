@@ -1163,3 +1163,53 @@ TEST_F(ComponentEventsTest, MediaFastNormal)
     auto event = root->popEvent();
     ASSERT_EQ(kEventTypeSendEvent, event.getType());
 }
+
+static const char *SCROLL_HANDLER_SCROLLS = R"(
+        {
+          "type": "APL",
+          "version": "1.4",
+          "mainTemplate": {
+            "items": {
+              "type": "ScrollView",
+              "height": 100,
+              "onScroll": [
+                {
+                  "type": "SetValue",
+                  "property": "scrollOffset",
+                  "value": 100
+                },
+                {
+                  "type": "SetValue",
+                  "componentId": "textComp",
+                  "property": "text",
+                  "value": "${event.source.value}"
+                }
+              ],
+              "item": {
+                "type": "Text",
+                "height": 400,
+                "id": "textComp",
+                "text": "One"
+              }
+            }
+          }
+        }
+)";
+
+/**
+ * The onScroll handler scrolls its own component.  The nested onScroll runs while the outer handler
+ * still holds its event context, so the nested handler must not overwrite the outer event values.
+ */
+TEST_F(ComponentEventsTest, ScrollHandlerKeepsEventContext)
+{
+    loadDocument(SCROLL_HANDLER_SCROLLS, DATA);
+    ASSERT_TRUE(component);
+    auto text = context->findComponentById("textComp");
+    ASSERT_TRUE(text);
+
+    component->update(kUpdateScrollPosition, 50);
+    root->clearPending();
+
+    ASSERT_EQ(Point(0, 100), component->scrollPosition());
+    ASSERT_EQ("0.5", text->getCalculated(kPropertyText).asString());
+}
@@ -856,4 +856,87 @@ TEST_F(ComponentDrawTest, Transforms) {
         child = as<CoreComponent>(component->getDisplayedChildAt(i));
         ASSERT_EQ(std::to_string(i + 1), child->getId());
     }
-}
\ No newline at end of file
+}
+
+static const char *SCROLL_CULLING =
+        R"apl({
+      "type": "APL",
+      "version": "1.4",
+      "mainTemplate": {
+        "item": {
+          "type": "Sequence",
+          "width": 200,
+          "height": 200,
+          "items": {
+            "type": "Frame",
+            "id": "${data}",
+            "width": 100,
+            "height": 50,
+            "transform": [
+              { "translateY": "${data == 3 ? 300 : 0}" }
+            ],
+            "item": {
+              "type": "Frame",
+              "id": "inner${data}",
+              "width": 10,
+              "height": 10
+            }
+          },
+          "data": "${Array.range(20)}"
+        }
+      }
+    }
+)apl";
+
+/**
+ * Displayed children of a scrolled component match a full scan of the children, including a child
+ * that has been translated far from its layout position.
+ */
+TEST_F(ComponentDrawTest, ScrollCulling) {
+    config->sequenceChildCache(5);
+    loadDocument(SCROLL_CULLING);
+    advanceTime(10);
+
+    auto check = [&](float position) -> ::testing::AssertionResult {
+        component->update(kUpdateScrollPosition, position);
+        root->clearPending();
+
+        Rect viewport(0, position, 200, 200);
+        std::vector<std::string> expected;
+        for (size_t i = 0; i < component->getChildCount(); i++) {
+            auto child = component->getCoreChildAt(i);
+            if (!child->isDisplayable())
+                continue;
+            auto t2d = child->getCalculated(kPropertyTransform).getTransform2D();
+            auto bounds = child->getCalculated(kPropertyBounds).getRect();
+            auto aabb = t2d.calculateAxisAlignedBoundingBox(Rect{0, 0, bounds.getWidth(), bounds.getHeight()});
+            aabb.offset(bounds.getTopLeft());
+            if (!viewport.intersect(aabb).isEmpty())
+                expected.emplace_back(child->getId());
+        }
+
+        std::vector<std::string> actual;
+        for (size_t i = 0; i < component->getDisplayedChildCount(); i++)
+            actual.emplace_back(component->getDisplayedChildAt(i)->getId());
+
+        if (expected != actual)
+            return ::testing::AssertionFailure() << "Mismatched displayed children at " << position;
+        return ::testing::AssertionSuccess();
+    };
+
+    ASSERT_TRUE(check(0));
+    ASSERT_TRUE(check(25));
+    ASSERT_TRUE(check(180));  // Child 3 is translated into view
+    ASSERT_TRUE(check(400));
+    ASSERT_TRUE(check(90));
+
+    // Scrolling updates the transforms of the descendants without marking them
+    auto inner = std::static_pointer_cast<CoreComponent>(root->findComponentById("inner5"));
+    ASSERT_TRUE(inner);
+    component->update(kUpdateScrollPosition, 100);
+    root->clearPending();
+    ASSERT_EQ(Point(0, 0), inner->toLocalPoint(Point(0, 150)));
+    component->update(kUpdateScrollPosition, 120);
+    root->clearPending();
+    ASSERT_EQ(Point(0, 20), inner->toLocalPoint(Point(0, 150)));
+}
@@ -14,6 +14,11 @@
  */
 
 
+#include <condition_variable>
+#include <thread>
+
+#include "apl/engine/layoutmanager.h"
+
 #include "../testeventloop.h"
 
 using namespace apl;
@@ -109,6 +114,132 @@ TEST_F(PagerTest, PageCacheByNavigation)
     ASSERT_TRUE(CheckChildrenLaidOut(pager, {0, 1, 2, 10, 11, 12, 19}));
 }
 
+static const char *CONCURRENT_LAYOUT = R"apl(
+    {
+      "type": "APL",
+      "version": "1.6",
+      "mainTemplate": {
+        "items": {
+          "type": "Pager",
+          "id": "pager",
+          "navigation": "normal",
+          "width": 100,
+          "height": 100,
+          "items": {
+            "type": "Frame",
+            "width": "100%",
+            "height": "100%",
+            "item": {
+              "type": "Text",
+              "width": "100%",
+              "text": "${data}"
+            }
+          },
+          "data": [
+            "AAAAA",
+            "AAAAAAAAAAAAAAA",
+            "AAAAAAAAAAAAAAAAAAAAAAAAA",
+            "AAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAA",
+            "AAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAA",
+            "AAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAA"
+          ]
+        }
+      }
+    }
+)apl";
+
+/**
+ * Text measurement that can hold each measurement until a second thread is measuring at the
+ * same time.  This proves that the layout calculations overlap.
+ */
+class RendezvousTextMeasurement : public SimpleTextMeasurement {
+public:
+    LayoutSize measure(Component *component, float width, MeasureMode widthMode,
+                       float height, MeasureMode heightMode) override {
+        std::unique_lock<std::mutex> lock(mMutex);
+        threads.emplace(std::this_thread::get_id());
+        mInside++;
+        maxInside = std::max(maxInside, mInside);
+        mChanged.notify_all();
+        if (rendezvous)
+            mChanged.wait_for(lock, std::chrono::seconds(5), [this] { return maxInside > 1; });
+        mInside--;
+        lock.unlock();
+
+        return SimpleTextMeasurement::measure(component, width, widthMode, height, heightMode);
+    }
+
+    bool rendezvous = false;
+    std::set<std::thread::id> threads;
+    int maxInside = 0;
+
+private:
+    std::mutex mMutex;
+    std::condition_variable mChanged;
+    int mInside = 0;
+};
+
+TEST_F(PagerTest, ConcurrentLayout)
+{
+    auto measure = std::make_shared<RendezvousTextMeasurement>();
+    config->measure(measure);
+    config->pagerChildCache(1);
+    config->set(RootProperty::kLayoutWorkerThreads, 4);
+    loadDocument(CONCURRENT_LAYOUT);
+    ASSERT_TRUE(component);
+    advanceTime(10);
+    ASSERT_TRUE(CheckChildrenLaidOut(component, {0, 1}));
+
+    // Pages 3, 4, and 5 are independent layout roots and are laid out in the same pass
+    measure->rendezvous = true;
+    component->update(kUpdatePagerByEvent, 4);
+    root->clearPending();
+    measure->rendezvous = false;
+    ASSERT_TRUE(CheckChildrenLaidOut(component, {0, 1, 3, 4, 5}));
+
+    // The measurements ran on more than one thread at the same time
+    ASSERT_LE(2, measure->maxInside);
+    ASSERT_EQ(3, measure->threads.size());
+    auto& stats = component->getContext()->layoutManager().passStatistics();
+    ASSERT_EQ(3, stats.concurrent);
+    ASSERT_EQ(3, stats.threads);
+
+    std::vector<Rect> concurrentBounds;
+    for (auto index : {0, 1, 3, 4, 5}) {
+        auto page = component->getChildAt(index);
+        concurrentBounds.emplace_back(page->getCalculated(kPropertyBounds).getRect());
+        concurrentBounds.emplace_back(page->getChildAt(0)->getCalculated(kPropertyBounds).getRect());
+    }
+
+    // Each text block wraps to one more line than the one on the previous page
+    for (auto index : {0, 1, 3, 4, 5}) {
+        auto page = component->getChildAt(index);
+        ASSERT_EQ(Rect(0, 0, 100, 100), page->getCalculated(kPropertyBounds).getRect()) << index;
+        ASSERT_EQ(Rect(0, 0, 100, 10 * (index + 1)),
+                  page->getChildAt(0)->getCalculated(kPropertyBounds).getRect()) << index;
+    }
+
+    // The same document laid out serially ends up with the same bounds.  Releasing the first root
+    // terminates its time manager, so the second root gets a new one.
+    loop = std::make_shared<TestTimeManager>();
+    config->timeManager(loop);
+    config->measure(std::make_shared<SimpleTextMeasurement>());
+    config->set(RootProperty::kLayoutWorkerThreads, 0);
+    loadDocument(CONCURRENT_LAYOUT);
+    advanceTime(10);
+    component->update(kUpdatePagerByEvent, 4);
+    root->clearPending();
+    ASSERT_TRUE(CheckChildrenLaidOut(component, {0, 1, 3, 4, 5}));
+    ASSERT_EQ(0, component->getContext()->layoutManager().passStatistics().concurrent);
+
+    std::vector<Rect> serialBounds;
+    for (auto index : {0, 1, 3, 4, 5}) {
+        auto page = component->getChildAt(index);
+        serialBounds.emplace_back(page->getCalculated(kPropertyBounds).getRect());
+        serialBounds.emplace_back(page->getChildAt(0)->getCalculated(kPropertyBounds).getRect());
+    }
+    ASSERT_EQ(serialBounds, concurrentBounds);
+}
 
 static const char *VARIABLE_SIZE = R"apl(
     {
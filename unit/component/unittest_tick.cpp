@@ -15,6 +15,8 @@
 
 #include "../testeventloop.h"
 
+#include "apl/engine/tickhandler.h"
+
 using namespace apl;
 
 class TickTest : public DocumentWrapper {};
@@ -490,3 +492,117 @@ TEST_F(TickTest, CantGo0) {
     advanceTime(1);
     ASSERT_TRUE(CheckSendEvent(root, 2.0));
 }
+
+TEST_F(TickTest, HandlerStaticCommands)
+{
+    rapidjson::Document doc;
+    doc.Parse(R"({"minimumDelay": 250, "commands": [ {"type": "SendEvent"}, {"type": "Idle"} ]})");
+    auto ctx = Context::createTestContext(metrics, *config);
+    TickHandler tick(*ctx, Object(doc));
+
+    ASSERT_EQ(250, tick.delay());
+
+    // The command list is array-ified once and shared by every tick
+    auto commands = tick.commands(*ctx);
+    ASSERT_EQ(2, commands.size());
+    ASSERT_EQ(&commands.getArray(), &tick.commands(*ctx).getArray());
+
+    // A missing command list gives no commands and the delay is clamped to the update limit
+    doc.Parse(R"({"minimumDelay": 0})");
+    TickHandler empty(*ctx, Object(doc));
+    ASSERT_EQ(config->getTickHandlerUpdateLimit(), empty.delay());
+    ASSERT_TRUE(empty.commands(*ctx).empty());
+}
+
+TEST_F(TickTest, HandlerDataBoundCommands)
+{
+    rapidjson::Document doc;
+    doc.Parse(R"({"minimumDelay": "${Delay}", "when": "${Enabled}", "commands": "${Commands}"})");
+    auto command = [](const char *type) {
+        return Object(std::make_shared<ObjectMap>(ObjectMap{{"type", type}}));
+    };
+    auto ctx = Context::createTestContext(metrics, *config);
+    ctx->putUserWriteable("Delay", 500);
+    ctx->putUserWriteable("Enabled", true);
+    ctx->putUserWriteable("Commands", ObjectArray{command("SendEvent")});
+    TickHandler tick(*ctx, Object(doc));
+
+    // The delay is calculated once
+    ASSERT_EQ(500, tick.delay());
+    ctx->userUpdateAndRecalculate("Delay", 100, false);
+    ASSERT_EQ(500, tick.delay());
+
+    // Data-bound commands and "when" clauses are evaluated on every tick
+    ASSERT_EQ(1, tick.commands(*ctx).size());
+    ctx->userUpdateAndRecalculate("Commands", ObjectArray{command("SendEvent"), command("Idle")}, false);
+    ASSERT_EQ(2, tick.commands(*ctx).size());
+
+    ctx->userUpdateAndRecalculate("Enabled", false, false);
+    ASSERT_TRUE(tick.commands(*ctx).empty());
+    ctx->userUpdateAndRecalculate("Enabled", true, false);
+    ASSERT_EQ(2, tick.commands(*ctx).size());
+}
+
+static const char *TICK_WHEN = R"({
+  "type": "APL",
+  "version": "1.4",
+  "mainTemplate": {
+    "item": {
+      "type": "Text",
+      "id": "MyText",
+      "bind": [
+        { "name": "Enabled", "value": true },
+        { "name": "Label", "value": "A" }
+      ],
+      "text": "${Label}",
+      "handleTick": {
+        "minimumDelay": 100,
+        "when": "${Enabled}",
+        "commands": [
+          {
+            "type": "SendEvent",
+            "sequencer": "SEQ_TICK",
+            "arguments": [ "${Label}" ]
+          }
+        ]
+      }
+    }
+  }
+})";
+
+TEST_F(TickTest, HandlerWhen)
+{
+    loadDocument(TICK_WHEN);
+
+    advanceTime(100);
+    ASSERT_TRUE(CheckSendEvent(root, "A"));
+
+    // A false "when" clause skips the tick but keeps the handler scheduled
+    executeCommand("SetValue", {{"componentId", "MyText"}, {"property", "Enabled"}, {"value", false}}, true);
+    advanceTime(100);
+    ASSERT_FALSE(root->hasEvent());
+
+    // Data-bound values follow the current state
+    executeCommand("SetValue", {{"componentId", "MyText"}, {"property", "Enabled"}, {"value", true}}, true);
+    executeCommand("SetValue", {{"componentId", "MyText"}, {"property", "Label"}, {"value", "B"}}, true);
+    advanceTime(100);
+    ASSERT_TRUE(CheckSendEvent(root, "B"));
+    ASSERT_FALSE(root->hasEvent());
+}
+
+TEST_F(TickTest, CancelledWithRootContext)
+{
+    loadDocument(SIMPLE);
+    advanceTime(100);
+    ASSERT_TRUE(CheckSendEvent(root, "100"));
+    ASSERT_EQ(3, loop->size());
+
+    // The document tick handler holds the document context; destroying the root cancels it
+    std::weak_ptr<Context> weakContext = context;
+    component = nullptr;
+    context = nullptr;
+    root = nullptr;
+
+    ASSERT_TRUE(weakContext.expired());
+    ASSERT_EQ(0, loop->size());
+}
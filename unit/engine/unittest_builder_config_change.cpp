@@ -750,3 +750,123 @@ TEST_F(BuilderConfigChange, ReinflateWithHandleTick)
     advanceTime(1100);
     ASSERT_EQ(1.0, text->getCalculated(kPropertyOpacity).getDouble());
 }
+
+static const char *INCREMENTAL_REINFLATE = R"apl(
+    {
+      "type": "APL",
+      "version": "1.5",
+      "mainTemplate": {
+        "item": {
+          "type": "ScrollView",
+          "width": "100%",
+          "height": "100%",
+          "item": {
+            "type": "Text",
+            "height": 2000,
+            "text": "Reader ${environment.screenReader ? 'on' : 'off'}"
+          }
+        }
+      },
+      "onConfigChange": { "type": "Reinflate" }
+    }
+)apl";
+
+/**
+ * A document that never reads the changed values keeps its component hierarchy and state
+ */
+TEST_F(BuilderConfigChange, IncrementalReinflation)
+{
+    metrics.size(1000,500);
+    config->set(RootProperty::kIncrementalReinflation, true);
+    loadDocument(INCREMENTAL_REINFLATE);
+    ASSERT_TRUE(component);
+
+    component->update(kUpdateScrollPosition, 300);
+    root->clearPending();
+    ASSERT_EQ(Point(0, 300), component->scrollPosition());
+    auto original = component;
+
+    // Rotate and change the font scale
+    configChangeReinflate(ConfigurationChange(500, 1000).fontScale(2.0));
+    root->clearPending();
+    ASSERT_EQ(original, component);
+    ASSERT_EQ(Point(0, 300), component->scrollPosition());
+    ASSERT_EQ(Rect(0, 0, 500, 1000), component->getCalculated(kPropertyBounds).getRect());
+
+    // New expressions see the new values
+    ASSERT_TRUE(IsEqual("reinflation", evaluate(*context, "${environment.reason}")));
+    ASSERT_TRUE(IsEqual(500, evaluate(*context, "${viewport.width}")));
+    ASSERT_TRUE(IsEqual(2.0, evaluate(*context, "${environment.fontScale}")));
+
+    // The document read the screen reader setting, so changing it rebuilds the hierarchy
+    configChangeReinflate(ConfigurationChange().screenReader(true));
+    ASSERT_TRUE(component);
+    ASSERT_NE(original, component);
+    ASSERT_TRUE(IsEqual("Reader on", component->getChildAt(0)->getCalculated(kPropertyText).asString()));
+}
+
+/**
+ * Resources selected by viewport size force a full re-inflation when the size changes
+ */
+TEST_F(BuilderConfigChange, IncrementalReinflationFallback)
+{
+    metrics.size(1000,500);
+    config->set(RootProperty::kIncrementalReinflation, true);
+    loadDocument(BASIC_REINFLATE);
+    ASSERT_TRUE(component);
+    auto original = component;
+
+    // The font scale was never read
+    configChangeReinflate(ConfigurationChange().fontScale(1.5));
+    ASSERT_EQ(original, component);
+    ASSERT_TRUE(IsEqual(Color(Color::BLUE), component->getCalculated(kPropertyBackgroundColor)));
+
+    configChangeReinflate(ConfigurationChange(500, 1000));
+    ASSERT_NE(original, component);
+    ASSERT_TRUE(IsEqual(Color(Color::RED), component->getCalculated(kPropertyBackgroundColor)));
+}
+
+TEST_F(BuilderConfigChange, IncrementalReinflationViewportUnits)
+{
+    metrics.size(1000,500);
+    config->set(RootProperty::kIncrementalReinflation, true);
+    loadDocument(R"apl({
+      "type": "APL",
+      "version": "1.5",
+      "mainTemplate": { "item": { "type": "Frame", "width": "50vw" } },
+      "onConfigChange": { "type": "Reinflate" }
+    })apl");
+    ASSERT_TRUE(component);
+    auto original = component;
+    ASSERT_EQ(500, component->getCalculated(kPropertyBounds).getRect().getWidth());
+
+    configChangeReinflate(ConfigurationChange(500, 1000));
+    ASSERT_NE(original, component);
+    ASSERT_EQ(250, component->getCalculated(kPropertyBounds).getRect().getWidth());
+}
+
+/**
+ * Reads are not recorded unless incremental reinflation was requested, and every change re-inflates
+ */
+TEST_F(BuilderConfigChange, IncrementalReinflationDisabled)
+{
+    loadDocument(INCREMENTAL_REINFLATE);
+    ASSERT_TRUE(component);
+    ASSERT_FALSE(context->trackEnvironmentReads());
+    auto original = component;
+
+    configChangeReinflate(ConfigurationChange().fontScale(1.5));
+    ASSERT_NE(original, component);
+}
+
+TEST_F(BuilderConfigChange, EnvironmentReadFlags)
+{
+    ASSERT_EQ(kEnvironmentReadViewportWidth, environmentReadFlags("viewport", "width"));
+    ASSERT_EQ(kEnvironmentReadViewportOther, environmentReadFlags("viewport", "shape"));
+    ASSERT_EQ(kEnvironmentReadViewport, environmentReadFlags("viewport", ""));
+    ASSERT_EQ(kEnvironmentReadFontScale, environmentReadFlags("environment", "fontScale"));
+    ASSERT_EQ(kEnvironmentReadEnvironmentOther, environmentReadFlags("environment", "lang"));
+    ASSERT_EQ(kEnvironmentReadEnvironment, environmentReadFlags("environment", ""));
+    ASSERT_EQ(0, environmentReadFlags("payload", "width"));
+    ASSERT_EQ(0, kEnvironmentReadViewport & kEnvironmentReadEnvironment);
+}
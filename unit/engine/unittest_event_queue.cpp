@@ -0,0 +1,158 @@
+/**
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#include "../testeventloop.h"
+
+#include "apl/engine/eventqueue.h"
+
+using namespace apl;
+
+class EventQueueTest : public DocumentWrapper {};
+
+/**
+ * Create an event tagged with a number, carried in the user data
+ */
+static Event
+makeEvent(intptr_t value)
+{
+    Event event(kEventTypeSendEvent, nullptr);
+    event.setUserData(reinterpret_cast<void*>(value));
+    return event;
+}
+
+static intptr_t
+tag(const Event& event)
+{
+    return reinterpret_cast<intptr_t>(event.getUserData());
+}
+
+TEST_F(EventQueueTest, Basic)
+{
+    EventQueue queue;
+    ASSERT_TRUE(queue.empty());
+
+    for (int i = 0 ; i < 5 ; i++)
+        queue.push(makeEvent(i));
+    ASSERT_EQ(5, queue.size());
+
+    for (int i = 0 ; i < 5 ; i++)
+        ASSERT_EQ(i, tag(queue.pop()));
+    ASSERT_TRUE(queue.empty());
+}
+
+TEST_F(EventQueueTest, Interleaved)
+{
+    EventQueue queue;
+    intptr_t pushed = 0;
+    intptr_t popped = 0;
+
+    // Pushing while events are still queued keeps them in order
+    for (int round = 0 ; round < 20 ; round++) {
+        for (int i = 0 ; i < 3 ; i++)
+            queue.push(makeEvent(pushed++));
+        for (int i = 0 ; i < 2 ; i++)
+            ASSERT_EQ(popped++, tag(queue.pop()));
+        ASSERT_EQ(pushed - popped, queue.size());
+    }
+
+    while (!queue.empty())
+        ASSERT_EQ(popped++, tag(queue.pop()));
+    ASSERT_EQ(pushed, popped);
+}
+
+TEST_F(EventQueueTest, Drain)
+{
+    EventQueue queue;
+    for (int i = 0 ; i < 4 ; i++)
+        queue.push(makeEvent(i));
+    ASSERT_EQ(0, tag(queue.pop()));
+
+    // Draining appends the remaining events after anything already in the vector
+    std::vector<Event> events = { makeEvent(-1) };
+    ASSERT_EQ(3, queue.drain(events));
+    ASSERT_TRUE(queue.empty());
+    ASSERT_EQ(4, events.size());
+    ASSERT_EQ(-1, tag(events.at(0)));
+    for (int i = 1 ; i < 4 ; i++)
+        ASSERT_EQ(i, tag(events.at(i)));
+
+    ASSERT_EQ(0, queue.drain(events));
+    ASSERT_EQ(4, events.size());
+}
+
+TEST_F(EventQueueTest, Bag)
+{
+    // Values are found by key whatever order they were added in, and the first value for a key wins
+    EventBag bag;
+    bag.emplace(kEventPropertyValue, 1);
+    bag.emplace(kEventPropertyName, "name");
+    ASSERT_FALSE(bag.emplace(kEventPropertyValue, 2).second);
+    bag.emplace("source", "url");
+
+    ASSERT_EQ(3, bag.size());
+    ASSERT_EQ(Object(1), bag.at(kEventPropertyValue));
+    ASSERT_EQ(Object("name"), bag.at(kEventPropertyName));
+    ASSERT_EQ(Object("url"), bag.at("source"));
+    ASSERT_EQ(bag.end(), bag.find(kEventPropertyReason));
+
+    // Iteration is in key order
+    std::vector<int> keys;
+    for (const auto& m : bag)
+        keys.emplace_back(m.first);
+    ASSERT_EQ(std::vector<int>({kEventPropertyName, kEventPropertySource, kEventPropertyValue}), keys);
+}
+
+static const char *SEND_EVENTS = R"apl(
+    {
+      "type": "APL",
+      "version": "1.8",
+      "mainTemplate": {
+        "items": {
+          "type": "TouchWrapper",
+          "width": 100,
+          "height": 100,
+          "onPress": [
+            { "type": "SendEvent", "arguments": [ "one" ] },
+            { "type": "SendEvent", "arguments": [ "two" ] },
+            { "type": "SendEvent", "arguments": [ "three" ] }
+          ]
+        }
+      }
+    }
+)apl";
+
+TEST_F(EventQueueTest, DrainEvents)
+{
+    loadDocument(SEND_EVENTS);
+
+    std::vector<Event> events;
+    ASSERT_EQ(0, root->drainEvents(events));
+
+    performClick(1, 1);
+    ASSERT_EQ(3, root->drainEvents(events));
+    ASSERT_FALSE(root->hasEvent());
+
+    std::vector<std::string> arguments;
+    for (const auto& m : events) {
+        ASSERT_EQ(kEventTypeSendEvent, m.getType());
+        arguments.emplace_back(m.getValue(kEventPropertyArguments).at(0).asString());
+    }
+    ASSERT_EQ(std::vector<std::string>({"one", "two", "three"}), arguments);
+
+    // The events can be handled again in the next frame using the same vector
+    events.clear();
+    performClick(1, 1);
+    ASSERT_EQ(3, root->drainEvents(events));
+}
@@ -0,0 +1,117 @@
+/**
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#include "../testeventloop.h"
+
+using namespace apl;
+
+class FrameBudgetTest : public DocumentWrapper {};
+
+static const char *PAGER = R"apl(
+    {
+      "type": "APL",
+      "version": "1.8",
+      "mainTemplate": {
+        "items": {
+          "type": "Pager",
+          "width": 200,
+          "height": 200,
+          "data": [0, 1, 2, 3, 4],
+          "items": {
+            "type": "Frame",
+            "width": "100%",
+            "height": "100%"
+          }
+        }
+      }
+    }
+)apl";
+
+TEST_F(FrameBudgetTest, PagerCache)
+{
+    loadDocument(PAGER);
+    advanceTime(10);
+    ASSERT_EQ(Rect(0, 0, 200, 200), component->getCoreChildAt(1)->getCalculated(kPropertyBounds).getRect());
+    ASSERT_TRUE(component->getCoreChildAt(2)->getCalculated(kPropertyBounds).getRect().empty());
+
+    // With no time left the new current page is laid out, but the cached page after it waits
+    component->update(kUpdatePagerPosition, 1);
+    ASSERT_TRUE(root->clearPending(0));
+    ASSERT_TRUE(component->getCoreChildAt(2)->getCalculated(kPropertyBounds).getRect().empty());
+
+    // The next pass finishes it
+    ASSERT_FALSE(root->clearPending(1000));
+    ASSERT_EQ(Rect(0, 0, 200, 200), component->getCoreChildAt(2)->getCalculated(kPropertyBounds).getRect());
+
+    // Skipping ahead lays out the new current page even with no time left
+    component->update(kUpdatePagerPosition, 3);
+    ASSERT_TRUE(root->clearPending(0));
+    ASSERT_EQ(Rect(0, 0, 200, 200), component->getCoreChildAt(3)->getCalculated(kPropertyBounds).getRect());
+    ASSERT_TRUE(component->getCoreChildAt(4)->getCalculated(kPropertyBounds).getRect().empty());
+
+    root->clearPending();
+    ASSERT_EQ(Rect(0, 0, 200, 200), component->getCoreChildAt(4)->getCalculated(kPropertyBounds).getRect());
+}
+
+static const char *SEQUENCE = R"apl(
+    {
+      "type": "APL",
+      "version": "1.8",
+      "mainTemplate": {
+        "items": {
+          "type": "Sequence",
+          "width": "100%",
+          "height": "100%",
+          "data": "${Array.range(40)}",
+          "items": {
+            "type": "Frame",
+            "width": "100%",
+            "height": 100
+          }
+        }
+      }
+    }
+)apl";
+
+TEST_F(FrameBudgetTest, SequenceCache)
+{
+    metrics.size(300, 300);
+    loadDocument(SEQUENCE);
+    advanceTime(10);
+    ASSERT_TRUE(component->getCoreChildAt(5)->isAttached());
+    ASSERT_FALSE(component->getCoreChildAt(10)->isAttached());
+
+    // The taller viewport is filled right away; the cache beyond it waits for the next frame
+    root->configurationChange(ConfigurationChange(300, 600));
+    ASSERT_FALSE(root->clearPending(0));
+    ASSERT_EQ(Rect(0, 500, 300, 100), component->getCoreChildAt(5)->getCalculated(kPropertyBounds).getRect());
+    ASSERT_FALSE(component->getCoreChildAt(10)->isAttached());
+
+    advanceTime(10);
+    ASSERT_TRUE(component->getCoreChildAt(10)->isAttached());
+    ASSERT_EQ(Rect(0, 1000, 300, 100), component->getCoreChildAt(10)->getCalculated(kPropertyBounds).getRect());
+}
+
+TEST_F(FrameBudgetTest, SequenceCacheWithTime)
+{
+    metrics.size(300, 300);
+    loadDocument(SEQUENCE);
+    advanceTime(10);
+
+    // With time to spare the cache is filled in the same pass, as with clearPending()
+    root->configurationChange(ConfigurationChange(300, 600));
+    ASSERT_FALSE(root->clearPending(1000000));
+    ASSERT_TRUE(component->getCoreChildAt(10)->isAttached());
+}
@@ -2063,6 +2063,58 @@ TEST_F(ExtensionClientTest, LiveDataCollapse) {
     ASSERT_EQ(true, changed.get("collapsed2").isNull());
 }
 
+static const char* ENTITY_MAP_SET_UNCOLLAPSED_FALSE = R"({
+  "version": "1.0",
+  "method": "LiveDataUpdate",
+  "name": "deviceState",
+  "target": "aplext:hello:10",
+  "operations": [
+    {
+      "type": "Set",
+      "key": "uncollapsed",
+      "item": false
+    }
+  ]
+})";
+
+TEST_F(ExtensionClientTest, LiveDataUncollapsedRepeatedSet) {
+    createConfigAndClient(COLLAPSED_EXT_DOC);
+
+    ASSERT_TRUE(client->processMessage(nullptr, EXT_REGISTER_SUCCESS));
+    ASSERT_FALSE(ConsoleMessage());
+
+    initializeContext();
+
+    // Sets of the same key between flushes are coalesced, so only one update event is sent
+    ASSERT_TRUE(client->processMessage(root, ENTITY_MAP_SET_UNCOLLAPSED));
+    ASSERT_TRUE(client->processMessage(root, ENTITY_MAP_SET_UNCOLLAPSED_FALSE));
+    ASSERT_TRUE(client->processMessage(root, ENTITY_MAP_SET_UNCOLLAPSED));
+    root->clearPending();
+
+    ASSERT_TRUE(root->hasEvent());
+    auto event = root->popEvent();
+    ASSERT_EQ(kEventTypeSendEvent, event.getType());
+    auto arguments = event.getValue(kEventPropertyArguments);
+    ASSERT_EQ(4, arguments.size());
+    ASSERT_EQ(true, arguments.at(0).getBoolean());
+    ASSERT_EQ(true, arguments.at(3).get("uncollapsed").getBoolean());
+    ASSERT_FALSE(root->hasEvent());
+
+    // The event carries the value at flush time
+    ASSERT_TRUE(client->processMessage(root, ENTITY_MAP_SET_UNCOLLAPSED_FALSE));
+    ASSERT_TRUE(client->processMessage(root, ENTITY_MAP_SET_UNCOLLAPSED));
+    ASSERT_TRUE(client->processMessage(root, ENTITY_MAP_SET_UNCOLLAPSED_FALSE));
+    root->clearPending();
+
+    ASSERT_TRUE(root->hasEvent());
+    event = root->popEvent();
+    arguments = event.getValue(kEventPropertyArguments);
+    ASSERT_EQ(4, arguments.size());
+    ASSERT_EQ(false, arguments.at(0).getBoolean());
+    ASSERT_EQ(false, arguments.at(3).get("uncollapsed").getBoolean());
+    ASSERT_FALSE(root->hasEvent());
+}
+
 static const char* EXT_REGISTER_SUCCESS_EXTENDED_TYPE = R"({
   "method": "RegisterSuccess",
   "version": "1.0",
@@ -525,7 +525,7 @@ TEST_F(ExtensionMediatorTest, RegistrationFlags) {
     loadExtensions(EXT_DOC);
 
     // direct access to extension for test inspection
-    auto hello = testExtensions["aplext:hello:10"];
+    auto hello = testExtensions["aplext:hello:10"].lock();
     ASSERT_TRUE(hello);
 
     ASSERT_EQ("--hello", hello->mFlags);
@@ -544,7 +544,7 @@ TEST_F(ExtensionMediatorTest, ParseSettings) {
     auto ext = extensionProvider->getExtension("aplext:hello:10");
     ASSERT_TRUE(ext);
     // direct access to extension for test inspection
-    auto hello = testExtensions["aplext:hello:10"];
+    auto hello = testExtensions["aplext:hello:10"].lock();
     ASSERT_TRUE(hello);
 
     ASSERT_EQ("MAGIC", hello->mAuthorizationCode);
@@ -942,6 +942,9 @@ TEST_F(ExtensionMediatorTest, DataUpdateBad) {
     // send a good update
     hello->generateLiveDataUpdate("aplext:hello:10", ENTITY_LIST_INSERT);
     ASSERT_FALSE(ConsoleMessage());
+    root->clearPending();
+    ASSERT_TRUE(root->hasEvent());
+    root->popEvent();
 }
 
 TEST_F(ExtensionMediatorTest, RegisterBad) {
@@ -1228,7 +1231,7 @@ TEST_F(ExtensionMediatorTest, FastInitializationFailInitialize) {
 
     ASSERT_FALSE(adapter->isRegistered(TEST_EXTENSION_URI));
     // Still considered loaded. Extension just not available.
-    ASSERT_TRUE(*loaded);
+    ASSERT_TRUE(*loaded);    ASSERT_TRUE(ConsoleMessage());
 }
 
 TEST_F(ExtensionMediatorTest, FastInitializationFailRegistrationRequest) {
@@ -1255,7 +1258,7 @@ TEST_F(ExtensionMediatorTest, FastInitializationFailRegistrationRequest) {
     });
 
     ASSERT_FALSE(adapter->isRegistered(TEST_EXTENSION_URI));
-    ASSERT_TRUE(*loaded);
+    ASSERT_TRUE(*loaded);    ASSERT_TRUE(ConsoleMessage());
 }
 
 TEST_F(ExtensionMediatorTest, FastInitializationFailRegistration) {
@@ -0,0 +1,253 @@
+/**
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#include "../testeventloop.h"
+
+#include "apl/graphic/graphic.h"
+#include "apl/graphic/graphicpathgeometry.h"
+
+using namespace apl;
+
+static const double PI = 3.14159265358979323846;
+
+class GraphicPathGeometryTest : public DocumentWrapper {};
+
+static ::testing::AssertionResult
+CheckCommands(const GraphicPathGeometryPtr& geometry, const std::vector<GraphicPathCommand>& commands)
+{
+    if (geometry->getCommands() != commands)
+        return ::testing::AssertionFailure() << "Command mismatch: " << geometry->toDebugString();
+    return ::testing::AssertionSuccess();
+}
+
+static ::testing::AssertionResult
+CheckPoints(const GraphicPathGeometryPtr& geometry, const std::vector<float>& points)
+{
+    const auto& actual = geometry->getPoints();
+    if (actual.size() != points.size())
+        return ::testing::AssertionFailure() << "Expected " << points.size() << " points, got " << actual.size();
+
+    for (size_t i = 0; i < points.size(); i++)
+        if (std::abs(actual.at(i) - points.at(i)) > 0.0001)
+            return ::testing::AssertionFailure() << "Point " << i << " expected=" << points.at(i)
+                                                 << " actual=" << actual.at(i);
+    return ::testing::AssertionSuccess();
+}
+
+TEST_F(GraphicPathGeometryTest, Lines)
+{
+    auto geometry = GraphicPathGeometry::create("M0,0 h100 v100 h-100 z");
+
+    ASSERT_TRUE(CheckCommands(geometry, {kGraphicPathCommandMoveTo,
+                                         kGraphicPathCommandLineTo,
+                                         kGraphicPathCommandLineTo,
+                                         kGraphicPathCommandLineTo,
+                                         kGraphicPathCommandClose}));
+    ASSERT_TRUE(CheckPoints(geometry, {0, 0, 100, 0, 100, 100, 0, 100}));
+    ASSERT_EQ(Rect(0, 0, 100, 100), geometry->getBounds());
+    ASSERT_NEAR(400, geometry->getLength(), 0.001);
+}
+
+TEST_F(GraphicPathGeometryTest, ImplicitCommands)
+{
+    // Coordinate pairs after a move are lines; relative moves after a close start at the sub-path origin
+    auto geometry = GraphicPathGeometry::create("m10 10 20 0 0 20z m5-5 l1e1,0");
+
+    ASSERT_TRUE(CheckCommands(geometry, {kGraphicPathCommandMoveTo,
+                                         kGraphicPathCommandLineTo,
+                                         kGraphicPathCommandLineTo,
+                                         kGraphicPathCommandClose,
+                                         kGraphicPathCommandMoveTo,
+                                         kGraphicPathCommandLineTo}));
+    ASSERT_TRUE(CheckPoints(geometry, {10, 10, 30, 10, 30, 30, 15, 5, 25, 5}));
+    ASSERT_EQ(Rect(10, 5, 20, 25), geometry->getBounds());
+}
+
+TEST_F(GraphicPathGeometryTest, Curves)
+{
+    // Smooth curves reflect the previous control point
+    auto geometry = GraphicPathGeometry::create("M0,0 C0,10 10,10 10,0 S20,-10 20,0 Q25,10 30,0 T40,0");
+
+    ASSERT_TRUE(CheckCommands(geometry, {kGraphicPathCommandMoveTo,
+                                         kGraphicPathCommandCubicTo,
+                                         kGraphicPathCommandCubicTo,
+                                         kGraphicPathCommandQuadTo,
+                                         kGraphicPathCommandQuadTo}));
+    ASSERT_TRUE(CheckPoints(geometry, {0, 0,
+                                       0, 10, 10, 10, 10, 0,
+                                       10, -10, 20, -10, 20, 0,
+                                       25, 10, 30, 0,
+                                       35, -10, 40, 0}));
+
+    // The bounds follow the curve, not the control points
+    auto bounds = geometry->getBounds();
+    ASSERT_NEAR(0, bounds.getX(), 0.001);
+    ASSERT_NEAR(-7.5, bounds.getY(), 0.001);
+    ASSERT_NEAR(40, bounds.getWidth(), 0.001);
+    ASSERT_NEAR(15, bounds.getHeight(), 0.001);
+}
+
+TEST_F(GraphicPathGeometryTest, Arc)
+{
+    // A half-circle of radius 50
+    auto geometry = GraphicPathGeometry::create("M0,50 A50,50 0 0 1 100,50");
+
+    ASSERT_EQ(kGraphicPathCommandMoveTo, geometry->getCommands().at(0));
+    for (size_t i = 1; i < geometry->getCommands().size(); i++)
+        ASSERT_EQ(kGraphicPathCommandCubicTo, geometry->getCommands().at(i));
+
+    auto bounds = geometry->getBounds();
+    ASSERT_NEAR(0, bounds.getX(), 0.01);
+    ASSERT_NEAR(0, bounds.getY(), 0.01);
+    ASSERT_NEAR(100, bounds.getWidth(), 0.01);
+    ASSERT_NEAR(50, bounds.getHeight(), 0.01);
+    ASSERT_NEAR(PI * 50, geometry->getLength(), 0.1);
+
+    // Compact flags and a zero radius (which degrades to a line)
+    geometry = GraphicPathGeometry::create("M0,0a10,10 0 1110,0 a0,5 0 0 0 10 0");
+    ASSERT_EQ(kGraphicPathCommandLineTo, geometry->getCommands().back());
+    auto& points = geometry->getPoints();
+    ASSERT_NEAR(20, points.at(points.size() - 2), 0.0001);
+    ASSERT_NEAR(0, points.at(points.size() - 1), 0.0001);
+}
+
+TEST_F(GraphicPathGeometryTest, Malformed)
+{
+    // Everything up to the error is retained
+    auto geometry = GraphicPathGeometry::create("M0,0 L10,10 L20 X30");
+    ASSERT_TRUE(CheckCommands(geometry, {kGraphicPathCommandMoveTo, kGraphicPathCommandLineTo}));
+    ASSERT_EQ(Rect(0, 0, 10, 10), geometry->getBounds());
+
+    geometry = GraphicPathGeometry::create("10,10");
+    ASSERT_TRUE(geometry->empty());
+    ASSERT_EQ(Rect(0, 0, 0, 0), geometry->getBounds());
+    ASSERT_EQ(0, geometry->getLength());
+}
+
+TEST_F(GraphicPathGeometryTest, MissingMove)
+{
+    // A path that does not start with a move starts at the origin
+    auto geometry = GraphicPathGeometry::create("L 10 10");
+    ASSERT_TRUE(CheckCommands(geometry, {kGraphicPathCommandMoveTo, kGraphicPathCommandLineTo}));
+    ASSERT_TRUE(CheckPoints(geometry, {0, 0, 10, 10}));
+    ASSERT_EQ(Rect(0, 0, 10, 10), geometry->getBounds());
+}
+
+TEST_F(GraphicPathGeometryTest, RepeatedMove)
+{
+    // Only the last of several consecutive moves is kept
+    auto geometry = GraphicPathGeometry::create("M0,0 M5,5 L10,10");
+    ASSERT_TRUE(CheckCommands(geometry, {kGraphicPathCommandMoveTo, kGraphicPathCommandLineTo}));
+    ASSERT_TRUE(CheckPoints(geometry, {5, 5, 10, 10}));
+    ASSERT_EQ(Rect(5, 5, 5, 5), geometry->getBounds());
+
+    // Relative moves accumulate before being collapsed
+    geometry = GraphicPathGeometry::create("m5,5 m5,5 l10,0");
+    ASSERT_TRUE(CheckCommands(geometry, {kGraphicPathCommandMoveTo, kGraphicPathCommandLineTo}));
+    ASSERT_TRUE(CheckPoints(geometry, {10, 10, 20, 10}));
+}
+
+TEST_F(GraphicPathGeometryTest, Cache)
+{
+    loadDocument(R"({"type": "APL", "version": "1.7", "mainTemplate": {"items": {"type": "Frame"}}})");
+    auto& cache = context->pathGeometries();
+
+    auto a = GraphicPathGeometry::create(*context, "M0,0 L7,7");
+    auto b = GraphicPathGeometry::create(*context, "M0,0 L7,7");
+    auto c = GraphicPathGeometry::create(*context, "M0,0 L7,8");
+
+    ASSERT_EQ(a, b);
+    ASSERT_NE(a, c);
+    ASSERT_EQ(2, cache.size());
+
+    // Animated path data evicts the oldest entries instead of growing the cache
+    for (int i = 0; i < 1000; i++)
+        GraphicPathGeometry::create(*context, "M0,0 L" + std::to_string(i) + ",0");
+    auto limit = cache.size();
+    ASSERT_GT(1000, limit);
+    ASSERT_FALSE(cache.has("M0,0 L7,7"));
+
+    // Evicted geometry stays valid for the elements that hold it
+    ASSERT_EQ(Rect(0, 0, 7, 7), a->getBounds());
+    GraphicPathGeometry::create(*context, "M0,0 L7,7");
+    ASSERT_EQ(limit, cache.size());
+}
+
+static const char *BOUND_PATH = R"apl(
+    {
+      "type": "APL",
+      "version": "1.7",
+      "graphics": {
+        "box": {
+          "type": "AVG",
+          "version": "1.2",
+          "height": 100,
+          "width": 100,
+          "parameters": [ "PathSize" ],
+          "items": [
+            {
+              "type": "group",
+              "items": {
+                "type": "path",
+                "pathData": "M0,0 L${PathSize},${PathSize}"
+              }
+            },
+            {
+              "type": "path",
+              "pathData": "M0,0 L${PathSize},${PathSize}"
+            }
+          ]
+        }
+      },
+      "mainTemplate": {
+        "items": {
+          "type": "VectorGraphic",
+          "id": "MyVG",
+          "source": "box",
+          "PathSize": 10
+        }
+      }
+    }
+)apl";
+
+TEST_F(GraphicPathGeometryTest, Element)
+{
+    loadDocument(BOUND_PATH);
+
+    auto graphic = component->getCalculated(kPropertyGraphic).getGraphic();
+    ASSERT_TRUE(graphic);
+    auto container = graphic->getRoot();
+    ASSERT_FALSE(container->getPathGeometry());
+
+    auto group = container->getChildAt(0);
+    ASSERT_FALSE(group->getPathGeometry());
+
+    auto path1 = group->getChildAt(0);
+    auto path2 = container->getChildAt(1);
+    auto geometry = path1->getPathGeometry();
+    ASSERT_TRUE(geometry);
+    ASSERT_EQ(Rect(0, 0, 10, 10), geometry->getBounds());
+
+    // Identical path strings share a single compiled geometry
+    ASSERT_EQ(geometry, path2->getPathGeometry());
+
+    // Changing the bound parameter recompiles the geometry and marks the path data dirty
+    executeCommand("SetValue", {{"componentId", "MyVG"}, {"property", "PathSize"}, {"value", 20}}, true);
+    ASSERT_TRUE(CheckDirty(path1, kGraphicPropertyPathData));
+    ASSERT_TRUE(CheckDirty(path2, kGraphicPropertyPathData));
+    ASSERT_NE(geometry, path1->getPathGeometry());
+    ASSERT_EQ(Rect(0, 0, 20, 20), path1->getPathGeometry()->getBounds());
+    ASSERT_EQ(path1->getPathGeometry(), path2->getPathGeometry());
+}
@@ -386,3 +386,70 @@ TEST_F(LiveArrayChangeTest, CombinedIteratorChanges)
     }));
     root->clearPending();
 }
+
+static size_t
+LiveArrayChangeCount(const std::string& key, const ContextPtr& context)
+{
+    for (const auto& t : context->dataManager().dirty()) {
+        if (t->getContext() == context && t->getKey() == key && t->asArray())
+            return t->asArray()->getChanges().size();
+    }
+    return 0;
+}
+
+TEST_F(LiveArrayChangeTest, CoalescedChanges)
+{
+    auto myArray = LiveArray::create(ObjectArray{1, 2, 3, 4});
+    config->liveData("TestArray", myArray);
+
+    loadDocument(ARRAY_TEST);
+
+    // Appending and prepending to a run of inserts extends the run
+    ASSERT_TRUE(myArray->insert(1, 10));  // 1,10,2,3,4
+    ASSERT_TRUE(myArray->insert(2, 11));  // 1,10,11,2,3,4
+    ASSERT_TRUE(myArray->insert(1, 12));  // 1,12,10,11,2,3,4
+    ASSERT_EQ(1, LiveArrayChangeCount("TestArray", context));
+    ASSERT_TRUE(LiveArrayTrack("TestArray", context, {{0,  false, 1},
+                                                      {-1, false, 12},
+                                                      {-1, false, 10},
+                                                      {-1, false, 11},
+                                                      {1,  false, 2},
+                                                      {2,  false, 3},
+                                                      {3,  false, 4}}));
+    root->clearPending();
+
+    // Removing at the same spot or just before the previous removal extends the range
+    ASSERT_TRUE(myArray->remove(2));  // 1,12,11,2,3,4
+    ASSERT_TRUE(myArray->remove(2));  // 1,12,2,3,4
+    ASSERT_TRUE(myArray->remove(1));  // 1,2,3,4
+    ASSERT_EQ(1, LiveArrayChangeCount("TestArray", context));
+    ASSERT_TRUE(LiveArrayTrack("TestArray", context, {{0, false, 1},
+                                                      {4, false, 2},
+                                                      {5, false, 3},
+                                                      {6, false, 4}}));
+    root->clearPending();
+
+    // Overlapping and touching updates merge; a gap does not
+    ASSERT_TRUE(myArray->update(1, 20));  // 1,20,3,4
+    ASSERT_TRUE(myArray->update(2, 30));  // 1,20,30,4
+    ASSERT_TRUE(myArray->update(1, 21));  // 1,21,30,4
+    ASSERT_EQ(1, LiveArrayChangeCount("TestArray", context));
+    ASSERT_TRUE(myArray->update(0, 5));   // 5,21,30,4
+    ASSERT_EQ(1, LiveArrayChangeCount("TestArray", context));
+    ASSERT_TRUE(LiveArrayTrack("TestArray", context, {{0, true,  5},
+                                                      {1, true,  21},
+                                                      {2, true,  30},
+                                                      {3, false, 4}}));
+    root->clearPending();
+
+    // Changes of different types or disjoint ranges stay separate
+    ASSERT_TRUE(myArray->insert(0, 7));   // 7,5,21,30,4
+    ASSERT_TRUE(myArray->insert(4, 8));   // 7,5,21,30,8,4
+    ASSERT_TRUE(myArray->remove(1));      // 7,21,30,8,4
+    ASSERT_EQ(3, LiveArrayChangeCount("TestArray", context));
+    ASSERT_TRUE(LiveArrayTrack("TestArray", context, {{-1, false, 7},
+                                                      {1,  false, 21},
+                                                      {2,  false, 30},
+                                                      {-1, false, 8},
+                                                      {3,  false, 4}}));
+}
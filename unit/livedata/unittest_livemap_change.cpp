@@ -280,4 +280,41 @@ TEST_F(LiveMapChangeTest, PopulateLayoutMap)
     root->clearPending();
 
     ASSERT_TRUE(IsEqual("think so", component->getCalculated(kPropertyText).asString()));
-}
\ No newline at end of file
+}
+
+TEST_F(LiveMapChangeTest, CoalescedChanges)
+{
+    auto myMap = LiveMap::create(ObjectMap{{"adjective", "happy"},
+                                           {"noun",      "dog"}});
+    config->liveData("TestMap", myMap);
+
+    loadDocument(MAP_TEST);
+    ASSERT_TRUE(component);
+
+    auto changeCount = [&]() -> size_t {
+        for (const auto& t : context->dataManager().dirty())
+            if (t->getKey() == "TestMap" && t->asMap())
+                return t->asMap()->getChanges().size();
+        return 0;
+    };
+
+    // Repeated sets of a key only record the first one
+    for (int i = 0 ; i < 10 ; i++)
+        myMap->set("noun", "cat" + std::to_string(i));
+    myMap->set("adjective", "sad");
+    myMap->set("noun", "cat");
+    ASSERT_EQ(2, changeCount());
+    ASSERT_TRUE(LiveMapTrack("TestMap", context,
+                             {{"adjective", "sad", true},
+                              {"noun",      "cat", true}}));
+    root->clearPending();
+    ASSERT_TRUE(IsEqual("sad cat", component->getCalculated(kPropertyText).asString()));
+
+    // A set after a remove is still recorded
+    myMap->set("noun", "bird");
+    myMap->remove("noun");
+    myMap->set("noun", "fish");
+    ASSERT_EQ(3, changeCount());
+    root->clearPending();
+    ASSERT_TRUE(IsEqual("sad fish", component->getCalculated(kPropertyText).asString()));
+}
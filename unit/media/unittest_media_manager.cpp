@@ -1659,4 +1659,106 @@ TEST_F(MediaManagerTest, SingleImageReinflateSameNotLoadedFirstHoldComponent)
 
     root->mediaLoaded("source0");
     advanceTime(100);
-}
\ No newline at end of file
+}
+static const char* SCATTERED_IMAGES = R"({
+  "type": "APL",
+  "version": "1.8",
+  "mainTemplate": {
+    "item": {
+      "type": "Container",
+      "width": "100%",
+      "height": "100%",
+      "items": [
+        { "type": "Image", "source": "far", "position": "absolute", "top": 2000, "width": 100, "height": 100 },
+        { "type": "Image", "source": "near", "position": "absolute", "top": 600, "width": 100, "height": 100 },
+        { "type": "Image", "source": "visible", "position": "absolute", "top": 100, "width": 100, "height": 100 }
+      ]
+    }
+  }
+})";
+
+/**
+ * Pop a media event and return its sources in order
+ */
+static std::vector<std::string>
+popMediaSources(const RootContextPtr& root, EventType type)
+{
+    std::vector<std::string> result;
+    if (!root->hasEvent())
+        return result;
+
+    auto event = root->popEvent();
+    if (event.getType() != type)
+        return result;
+
+    for (const auto& m : event.getValue(kEventPropertySource).getArray())
+        result.emplace_back(m.getString());
+    return result;
+}
+
+TEST_F(MediaManagerTest, ViewportOrder)
+{
+    metrics.size(500, 500);
+    loadDocument(SCATTERED_IMAGES);
+
+    ASSERT_EQ(std::vector<std::string>({"visible", "near", "far"}), popMediaSources(root, kEventTypeMediaRequest));
+    ASSERT_FALSE(root->hasEvent());
+}
+
+TEST_F(MediaManagerTest, InFlightLimit)
+{
+    metrics.size(500, 500);
+    config->set(RootProperty::kMaxMediaRequestsInFlight, 1);
+    loadDocument(SCATTERED_IMAGES);
+
+    ASSERT_EQ(std::vector<std::string>({"visible"}), popMediaSources(root, kEventTypeMediaRequest));
+    ASSERT_FALSE(root->hasEvent());
+
+    // Nothing more is sent until the outstanding request finishes
+    root->clearPending();
+    ASSERT_FALSE(root->hasEvent());
+
+    root->mediaLoaded("visible");
+    root->clearPending();
+    ASSERT_EQ(std::vector<std::string>({"near"}), popMediaSources(root, kEventTypeMediaRequest));
+    ASSERT_FALSE(root->hasEvent());
+
+    root->mediaLoadFailed("near", 404, "Not found");
+    root->clearPending();
+    ASSERT_EQ(std::vector<std::string>({"far"}), popMediaSources(root, kEventTypeMediaRequest));
+    ASSERT_FALSE(root->hasEvent());
+}
+
+TEST_F(MediaManagerTest, InFlightCancel)
+{
+    auto myArray = LiveArray::create(ObjectArray{0, 1, 2});
+    config->liveData("TestArray", myArray);
+    config->set(RootProperty::kMaxMediaRequestsInFlight, 2);
+    loadDocument(LIVE_CHANGES);
+
+    ASSERT_EQ(std::vector<std::string>({"universe0", "universe1"}), popMediaSources(root, kEventTypeMediaRequest));
+    ASSERT_FALSE(root->hasEvent());
+
+    // Dropping an image that is still loading cancels its request and frees up a slot
+    myArray->remove(1);
+    root->clearPending();
+    ASSERT_EQ(std::vector<std::string>({"universe1"}), popMediaSources(root, kEventTypeMediaCancel));
+    ASSERT_EQ(std::vector<std::string>({"universe2"}), popMediaSources(root, kEventTypeMediaRequest));
+    ASSERT_FALSE(root->hasEvent());
+
+    // A late load of the cancelled source is ignored
+    root->mediaLoaded("universe1");
+    root->clearPending();
+    ASSERT_FALSE(root->hasEvent());
+
+    // An image that is replaced by the same source in one frame keeps its outstanding request
+    myArray->remove(0);
+    myArray->push_back(0);
+    root->clearPending();
+    ASSERT_FALSE(root->hasEvent());
+
+    root->mediaLoaded("universe0");
+    auto image = component->getCoreChildAt(1);
+    ASSERT_EQ(Object("universe0"), image->getCalculated(kPropertySource));
+    ASSERT_EQ(kMediaStateReady, image->getCalculated(kPropertyMediaState).getInteger());
+}
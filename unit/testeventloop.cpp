@@ -14,6 +14,7 @@
  */
 
 #include "testeventloop.h"
+#include "apl/command/commandtemplate.h"
 #include "apl/livedata/livearrayobject.h"
 #include "apl/livedata/livemapobject.h"
 #include "apl/graphic/graphicelementcontainer.h"
@@ -58,6 +59,7 @@ getMemoryCounterMap() {
     static std::map<std::string, std::function<CounterPair()>> sMemoryCounters = {
         {"Action",                  Counter<Action>::itemsDelta},
         {"Command",                 Counter<Command>::itemsDelta},
+        {"CommandTemplate",         Counter<CommandTemplate>::itemsDelta},
         {"Component",               Counter<Component>::itemsDelta},
         {"Content",                 Counter<Content>::itemsDelta},
         {"Context",                 Counter<Context>::itemsDelta},
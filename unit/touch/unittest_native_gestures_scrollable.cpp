@@ -152,6 +152,90 @@ TEST_F(NativeGesturesScrollableTest, Scroll)
     ASSERT_EQ(Point(0, 0), component->scrollPosition());
 }
 
+TEST_F(NativeGesturesScrollableTest, BatchedMoves)
+{
+    loadDocument(SCROLL_TEST);
+
+    ASSERT_TRUE(HandlePointerEvent(root, PointerEventType::kPointerDown, Point(0,100), false, "onDown:green1"));
+    advanceTime(100);
+
+    // Moves within the slop are coalesced into a single dispatch
+    auto now = root->currentTime();
+    ASSERT_FALSE(root->handlePointerEvents({
+        PointerSample(PointerEvent(kPointerMove, Point(0,99)), now - 30),
+        PointerSample(PointerEvent(kPointerMove, Point(0,98)), now - 20),
+        PointerSample(PointerEvent(kPointerMove, Point(0,97)), now - 10),
+    }));
+    ASSERT_TRUE(CheckSendEvent(root, "onMove:green1"));
+    ASSERT_FALSE(root->hasEvent());
+
+    // A move from a different pointer splits the run
+    advanceTime(100);
+    now = root->currentTime();
+    ASSERT_FALSE(root->handlePointerEvents({
+        PointerSample(PointerEvent(kPointerMove, Point(0,96)), now - 30),
+        PointerSample(PointerEvent(kPointerMove, Point(50,50), 1, kTouchPointer), now - 20),
+        PointerSample(PointerEvent(kPointerMove, Point(0,95)), now - 10),
+        PointerSample(PointerEvent(kPointerMove, Point(0,94)), now),
+    }));
+    ASSERT_TRUE(CheckSendEvent(root, "onMove:green1"));
+    ASSERT_TRUE(CheckSendEvent(root, "onMove:green1"));
+    ASSERT_FALSE(root->hasEvent());
+
+    // An up event ends the run.  The events and the result match the same samples sent one at a time.
+    advanceTime(100);
+    now = root->currentTime();
+    ASSERT_TRUE(root->handlePointerEvents({
+        PointerSample(PointerEvent(kPointerMove, Point(0,93)), now - 20),
+        PointerSample(PointerEvent(kPointerMove, Point(0,92)), now - 10),
+        PointerSample(PointerEvent(kPointerUp, Point(0,92)), now),
+        PointerSample(PointerEvent(kPointerMove, Point(0,91)), now),
+    }));
+    ASSERT_TRUE(CheckSendEvent(root, "onMove:green1"));
+    ASSERT_TRUE(CheckSendEvent(root, "onUp:green1"));
+    ASSERT_FALSE(root->hasEvent());
+    ASSERT_EQ(Point(), component->scrollPosition());
+}
+
+TEST_F(NativeGesturesScrollableTest, BatchedMovesFling)
+{
+    loadDocument(SCROLL_TEST);
+
+    // Drag with a change of speed part way through and return the resting position after the fling
+    auto drag = [&](bool batched, bool dropIntermediate) {
+        component->update(kUpdateScrollPosition, 0);
+        root->clearPending();
+
+        HandlePointerEvent(root, PointerEventType::kPointerDown, Point(0,100), false);
+        if (batched) {
+            advanceTime(400);
+            auto now = root->currentTime();
+            std::vector<PointerSample> samples;
+            if (!dropIntermediate)
+                samples.emplace_back(PointerEvent(kPointerMove, Point(0,80)), now - 200);
+            samples.emplace_back(PointerEvent(kPointerMove, Point(0,0)), now);
+            root->handlePointerEvents(samples);
+        } else {
+            advanceTime(200);
+            HandlePointerEvent(root, PointerEventType::kPointerMove, Point(0,80), true);
+            advanceTime(200);
+            HandlePointerEvent(root, PointerEventType::kPointerMove, Point(0,0), true);
+        }
+        HandlePointerEvent(root, PointerEventType::kPointerUp, Point(0,0), true);
+        advanceTime(3000);
+        while (root->hasEvent())
+            root->popEvent();
+        return component->scrollPosition();
+    };
+
+    auto unbatched = drag(false, false);
+    ASSERT_LT(100, unbatched.getY());
+
+    // The coalesced sample still contributes to the fling velocity
+    ASSERT_EQ(unbatched, drag(true, false));
+    ASSERT_NE(unbatched, drag(true, true));
+}
+
 TEST_F(NativeGesturesScrollableTest, ScrollRotated)
 {
     loadDocument(SCROLL_TEST);
@@ -215,3 +215,161 @@ TEST_F(EventLoopWrapper, AnimatorCreatesTimeout)
 
     ASSERT_EQ(2, timeoutCalls);
 }
+
+TEST_F(EventLoopWrapper, Interval)
+{
+    int count = 0;
+    auto id = loop->setInterval([&]() {
+        count++;
+        return true;
+    }, 100);
+
+    // A single timer is re-armed for each tick
+    ASSERT_EQ(1, loop->size());
+    ASSERT_EQ(100, loop->nextTimeout());
+
+    loop->advanceBy(99);
+    ASSERT_EQ(0, count);
+
+    loop->advanceBy(1);
+    ASSERT_EQ(1, count);
+    ASSERT_EQ(1, loop->size());
+    ASSERT_EQ(200, loop->nextTimeout());
+
+    // Jumping ahead fires every missed interval
+    loop->advanceBy(350);
+    ASSERT_EQ(4, count);
+    ASSERT_EQ(500, loop->nextTimeout());
+
+    // The original id cancels the interval
+    ASSERT_TRUE(loop->clearTimeout(id));
+    ASSERT_FALSE(loop->clearTimeout(id));
+    ASSERT_EQ(0, loop->size());
+
+    loop->advanceBy(1000);
+    ASSERT_EQ(4, count);
+}
+
+TEST_F(EventLoopWrapper, IntervalStopsItself)
+{
+    int count = 0;
+    loop->setInterval([&]() {
+        count++;
+        return count < 3;
+    }, 100);
+
+    loop->advanceBy(1000);
+    ASSERT_EQ(3, count);
+    ASSERT_EQ(0, loop->size());
+
+    // Cancelling from inside the ticker also stops the interval
+    count = 0;
+    timeout_id id = 0;
+    id = loop->setInterval([&]() {
+        count++;
+        if (count == 2)
+            EXPECT_TRUE(loop->clearTimeout(id));
+        return true;
+    }, 10);
+
+    loop->advanceBy(1000);
+    ASSERT_EQ(2, count);
+    ASSERT_EQ(0, loop->size());
+}
+
+TEST_F(EventLoopWrapper, ClearManyTimeouts)
+{
+    std::vector<timeout_id> ids;
+    int count = 0;
+    for (int i = 0 ; i < 1000 ; i++)
+        ids.push_back(loop->setTimeout([&]() { count++; }, 10 + i % 50));
+
+    // Cancel every other timer, out of order
+    for (int i = 999 ; i >= 0 ; i -= 2)
+        ASSERT_TRUE(loop->clearTimeout(ids.at(i)));
+    ASSERT_EQ(500, loop->size());
+    ASSERT_EQ(10, loop->nextTimeout());
+
+    // Cleared slots are reused without disturbing the remaining timers
+    loop->setTimeout([&]() { count += 1000; }, 25);
+    ASSERT_EQ(501, loop->size());
+
+    loop->advanceToEnd();
+    ASSERT_EQ(1500, count);
+    ASSERT_EQ(58, loop->currentTime());
+}
+
+TEST_F(EventLoopWrapper, AnimatorsModifiedDuringUpdate)
+{
+    std::vector<int> calls = {0, 0, 0};
+    timeout_id ids[3];
+
+    // The first animator removes the second and then itself
+    ids[0] = loop->setAnimator([&](apl_duration_t delta) {
+        calls[0]++;
+        loop->clearTimeout(ids[1]);
+        loop->clearTimeout(ids[0]);
+    }, 1000);
+    ids[1] = loop->setAnimator([&](apl_duration_t delta) { calls[1]++; }, 1000);
+    ids[2] = loop->setAnimator([&](apl_duration_t delta) {
+        // Animators started during an update wait for the next one
+        if (calls[2]++ == 0)
+            loop->setAnimator([&](apl_duration_t delta) { calls.push_back(delta); }, 1000);
+    }, 1000);
+
+    ASSERT_EQ(3, loop->animatorCount());
+
+    loop->advanceBy(100);
+    ASSERT_EQ(std::vector<int>({1, 0, 1}), calls);
+    ASSERT_EQ(2, loop->animatorCount());
+
+    loop->advanceBy(100);
+    ASSERT_EQ(std::vector<int>({1, 0, 2, 100}), calls);
+
+    loop->advanceToEnd();
+    ASSERT_EQ(0, loop->animatorCount());
+    ASSERT_EQ(0, loop->size());
+}
+
+TEST_F(EventLoopWrapper, SameTimeCancel)
+{
+    std::vector<int> order;
+    loop->setTimeout([&]() { order.push_back(1); }, 200);
+    loop->setInterval([&]() { order.push_back(2); return true; }, 100);
+    loop->setTimeout([&]() { order.push_back(3); }, 200);
+    auto id = loop->setTimeout([&]() { order.push_back(4); }, 200);
+    loop->setTimeout([&]() { order.push_back(5); }, 200);
+    ASSERT_TRUE(loop->clearTimeout(id));
+    ASSERT_FALSE(loop->clearTimeout(id));
+
+    // Cancelling one of several timers due at the same time leaves the others in place
+    loop->advanceBy(200);
+    std::sort(order.begin(), order.end());
+    ASSERT_EQ(std::vector<int>({1, 2, 2, 3, 5}), order);
+    ASSERT_EQ(1, loop->size());
+
+    loop->clear();
+}
+
+TEST_F(EventLoopWrapper, AnimatorStartedByTimeout)
+{
+    std::vector<int> calls;
+    auto animator = [&](apl_duration_t delta) { calls.push_back(delta); };
+
+    // A timeout that fires before the new time starts an animator that catches up immediately
+    loop->setTimeout([&]() { loop->setAnimator(animator, 1000); }, 10);
+    loop->advanceBy(50);
+    ASSERT_EQ(std::vector<int>({40}), calls);
+
+    // A timeout that fires exactly at the new time starts an animator that runs with no elapsed time
+    calls.clear();
+    loop->clear();
+    loop->setTimeout([&]() { loop->setAnimator(animator, 1000); }, 50);
+    loop->advanceBy(50);
+    ASSERT_EQ(std::vector<int>({0}), calls);
+
+    loop->advanceBy(30);
+    ASSERT_EQ(std::vector<int>({0, 30}), calls);
+
+    loop->clear();
+}